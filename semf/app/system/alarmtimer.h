@@ -0,0 +1,50 @@
+/**
+ * @file alarmtimer.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_APP_SYSTEM_ALARMTIMER_H_
+#define SEMF_APP_SYSTEM_ALARMTIMER_H_
+
+#include <semf/app/system/timer.h>
+#include <cstdint>
+
+namespace semf
+{
+namespace app
+{
+/**
+ * @brief Class for using a free running timer hardware with a compare unit.
+ *
+ * The counter runs continuously after \c start() and wraps around at its maximum value.
+ * \c timeout is emitted when the counter reaches the tick set by \c setAlarm().
+ * In contrast to a periodic \c Timer there is no interrupt as long as no alarm is set.
+ */
+class AlarmTimer : public Timer
+{
+public:
+	AlarmTimer() = default;
+	explicit AlarmTimer(const AlarmTimer& other) = delete;
+	virtual ~AlarmTimer() = default;
+
+	/**
+	 * @brief Returns the actual counter value.
+	 * @return Counter value in ticks.
+	 */
+	virtual uint32_t now() const = 0;
+	/**
+	 * @brief Sets the tick on which \c timeout is emitted once.
+	 * @note A previously set alarm is replaced.
+	 * @param tick Counter value for the alarm.
+	 */
+	virtual void setAlarm(uint32_t tick) = 0;
+	/**Disables the alarm.*/
+	virtual void clearAlarm() = 0;
+};
+} /* namespace app */
+} /* namespace semf */
+#endif /* SEMF_APP_SYSTEM_ALARMTIMER_H_ */
@@ -0,0 +1,188 @@
+/**
+ * @file i2cbusscheduler.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/communication/i2cbusscheduler.h>
+#include <semf/system/criticalsection.h>
+#include <semf/utils/core/debug.h>
+
+namespace semf
+{
+I2cBusScheduler::I2cBusScheduler(I2cMasterHardware& hardware)
+: m_hardware(hardware)
+{
+	m_hardware.dataWritten.connect(m_onDataWrittenSlot);
+	m_hardware.dataAvailable.connect(m_onDataAvailableSlot);
+	m_hardware.error.connect(m_onErrorSlot);
+}
+
+bool I2cBusScheduler::isBusy() const
+{
+	return m_active != nullptr;
+}
+
+void I2cBusScheduler::addDevice(I2cDevice& device)
+{
+	CriticalSection::enter();
+	m_devices.pushBack(device);
+	CriticalSection::exit();
+}
+
+void I2cBusScheduler::removeDevice(I2cDevice& device)
+{
+	CriticalSection::enter();
+	if (m_activeDevice == &device)
+		m_activeDevice = nullptr;
+	m_devices.erase(LinkedList<I2cDevice>::Iterator(&device));
+	LinkedQueue<I2cTransaction> dropped;
+	while (!device.m_queue.empty())
+	{
+		I2cTransaction& transaction = device.m_queue.front();
+		device.m_queue.pop();
+		dropped.push(transaction);
+	}
+	CriticalSection::exit();
+
+	// Each transaction leaves the queue before its error is emitted, so it can be submitted again from the slot.
+	while (!dropped.empty())
+	{
+		I2cTransaction& transaction = dropped.front();
+		dropped.pop();
+		transaction.m_pending = false;
+		SEMF_ERROR("transaction dropped");
+		transaction.error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Remove_TransactionsDropped)));
+	}
+}
+
+void I2cBusScheduler::submit(I2cDevice& device, I2cTransaction& transaction)
+{
+	SEMF_INFO("submit, address %u", device.address());
+	if (transaction.m_pending)
+	{
+		SEMF_ERROR("is pending");
+		transaction.error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Submit_IsPending)));
+		return;
+	}
+	bool writes = transaction.m_type != I2cTransaction::Type::Read;
+	bool reads = transaction.m_type != I2cTransaction::Type::Write;
+	if ((writes && transaction.m_writeData == nullptr) || (reads && transaction.m_readBuffer == nullptr))
+	{
+		SEMF_ERROR("data is nullptr");
+		transaction.error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Submit_DataIsNullptr)));
+		return;
+	}
+	if ((writes && transaction.m_writeDataSize == 0) || (reads && transaction.m_readBufferSize == 0))
+	{
+		SEMF_ERROR("data size is 0");
+		transaction.error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Submit_DataSizeIsZero)));
+		return;
+	}
+
+	CriticalSection::enter();
+	transaction.m_pending = true;
+	device.m_queue.push(transaction);
+	bool start = m_active == nullptr && dequeue();
+	CriticalSection::exit();
+
+	if (start)
+		startTransaction();
+}
+
+bool I2cBusScheduler::dequeue()
+{
+	I2cDevice* next = nullptr;
+	for (I2cDevice& device : m_devices)
+	{
+		if (!device.m_queue.empty() && (next == nullptr || device.m_priority > next->m_priority))
+			next = &device;
+	}
+
+	if (next == nullptr)
+	{
+		m_active = nullptr;
+		return false;
+	}
+	// The served device moves to the end of the list, so devices with the same priority take turns.
+	m_devices.erase(LinkedList<I2cDevice>::Iterator(next));
+	m_devices.pushBack(*next);
+	m_activeDevice = next;
+	m_active = &next->m_queue.front();
+	next->m_queue.pop();
+	return true;
+}
+
+void I2cBusScheduler::startTransaction()
+{
+	I2cTransaction& transaction = *m_active;
+	m_hardware.setAddress(m_activeDevice->m_address);
+	if (transaction.m_type == I2cTransaction::Type::Read)
+	{
+		m_reading = true;
+		m_hardware.setFrame(CommunicationHardware::Frame::FirstAndLast);
+		m_hardware.read(transaction.m_readBuffer, transaction.m_readBufferSize);
+	}
+	else
+	{
+		// A write-read ends the write without stop condition and continues with a repeated start.
+		m_reading = false;
+		m_hardware.setFrame(transaction.m_type == I2cTransaction::Type::WriteRead ? CommunicationHardware::Frame::First
+																				   : CommunicationHardware::Frame::FirstAndLast);
+		m_hardware.write(transaction.m_writeData, transaction.m_writeDataSize);
+	}
+}
+
+void I2cBusScheduler::finishTransaction(const Error* thrown)
+{
+	I2cTransaction& transaction = *m_active;
+
+	CriticalSection::enter();
+	transaction.m_pending = false;
+	bool next = dequeue();
+	CriticalSection::exit();
+
+	// Start the next transaction first to keep the bus busy while the finished one is processed.
+	if (next)
+		startTransaction();
+	if (thrown == nullptr)
+		transaction.finished();
+	else
+		transaction.error(*thrown);
+}
+
+void I2cBusScheduler::onDataWritten()
+{
+	if (m_active == nullptr)
+		return;
+
+	if (m_active->m_type == I2cTransaction::Type::WriteRead && !m_reading)
+	{
+		m_reading = true;
+		m_hardware.setFrame(CommunicationHardware::Frame::Last);
+		m_hardware.read(m_active->m_readBuffer, m_active->m_readBufferSize);
+		return;
+	}
+	finishTransaction(nullptr);
+}
+
+void I2cBusScheduler::onDataAvailable()
+{
+	if (m_active == nullptr)
+		return;
+
+	finishTransaction(nullptr);
+}
+
+void I2cBusScheduler::onError(Error thrown)
+{
+	if (m_active == nullptr)
+		return;
+
+	SEMF_ERROR("transaction failed");
+	finishTransaction(&thrown);
+}
+} /* namespace semf */
@@ -0,0 +1,130 @@
+/**
+ * @file i2cbusscheduler.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_COMMUNICATION_I2CBUSSCHEDULER_H_
+#define SEMF_COMMUNICATION_I2CBUSSCHEDULER_H_
+
+#include <semf/communication/i2cdevice.h>
+#include <semf/communication/i2cmasterhardware.h>
+#include <semf/communication/i2ctransaction.h>
+#include <semf/utils/core/error.h>
+#include <semf/utils/core/lists/linkedlist.h>
+#include <semf/utils/core/signals/slot.h>
+
+namespace semf
+{
+/**
+ * @brief Shares one \c I2cMasterHardware between several \c I2cDevice handles.
+ *
+ * Devices submit \c I2cTransaction objects into their own queue. The scheduler executes them one after another and
+ * starts the next transaction directly from the completion interrupt of the previous one, before the \c finished
+ * signal of the previous transaction is emitted. So drivers do not have to check the bus state or to retry.
+ *
+ * The next transaction is taken from the device with the highest priority. Devices with the same priority take
+ * turns, so a device with many transactions does not block the others.
+ *
+ * @note The scheduler must be the only user of the hardware, because it handles all of its signals.
+ * @note For using \c I2cBusScheduler a global \c CriticalSection object is required.
+ */
+class I2cBusScheduler
+{
+public:
+	/**
+	 * @brief Error codes for this class. Error ID identify a unique error() / onError call (excluding transferring).
+	 */
+	enum class ErrorCode : uint8_t
+	{
+		Submit_IsPending = 0,
+		Submit_DataIsNullptr,
+		Submit_DataSizeIsZero,
+		Remove_TransactionsDropped
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param hardware I2C master hardware of the bus.
+	 */
+	explicit I2cBusScheduler(I2cMasterHardware& hardware);
+	explicit I2cBusScheduler(const I2cBusScheduler& other) = delete;
+	virtual ~I2cBusScheduler() = default;
+
+	/**
+	 * @brief Returns if a transaction is executed at the moment.
+	 * @return \c true if busy, otherwise \c false.
+	 */
+	bool isBusy() const;
+
+private:
+	/**
+	 * @brief Registers a device.
+	 * @param device Device to register.
+	 */
+	void addDevice(I2cDevice& device);
+	/**
+	 * @brief Unregisters a device and drops its queued transactions.
+	 * @note A transaction of the device already running on the bus is finished normally.
+	 * @param device Device to unregister.
+	 * @throws Remove_TransactionsDropped By every queued transaction of \c device.
+	 */
+	void removeDevice(I2cDevice& device);
+	/**
+	 * @brief Appends \c transaction to the queue of \c device and starts it if the bus is free.
+	 * @param device Device submitting the transaction.
+	 * @param transaction Transaction to execute.
+	 * @throws Submit_IsPending If \c transaction is already pending.
+	 * @throws Submit_DataIsNullptr If write data or read buffer is a nullptr.
+	 * @throws Submit_DataSizeIsZero If write data size or read buffer size is zero.
+	 */
+	void submit(I2cDevice& device, I2cTransaction& transaction);
+	/**
+	 * @brief Takes the next transaction out of the device queues and makes it the active one.
+	 * @note Has to be called inside a critical section.
+	 * @return \c true if there is a next transaction, \c false if all queues are empty.
+	 */
+	bool dequeue();
+	/**Starts the active transaction on the hardware.*/
+	void startTransaction();
+	/**
+	 * @brief Finishes the active transaction, starts the next one and emits the active transaction's signal.
+	 * @param thrown Error of a failed transaction, \c nullptr if the transaction was successful.
+	 */
+	void finishTransaction(const Error* thrown);
+	/**Slot for the \c dataWritten signal of the hardware.*/
+	void onDataWritten();
+	/**Slot for the \c dataAvailable signal of the hardware.*/
+	void onDataAvailable();
+	/**
+	 * @brief Slot for the \c error signal of the hardware.
+	 * @param thrown A thrown error object.
+	 */
+	void onError(Error thrown);
+
+	/**I2C master hardware of the bus.*/
+	I2cMasterHardware& m_hardware;
+	/**Registered devices, the device served last is at the end.*/
+	LinkedList<I2cDevice> m_devices;
+	/**Transaction on the bus.*/
+	I2cTransaction* m_active = nullptr;
+	/**Device of the transaction on the bus.*/
+	I2cDevice* m_activeDevice = nullptr;
+	/**Read part of a write-read transaction is on the bus.*/
+	bool m_reading = false;
+	/**Slot for onDataWritten function.*/
+	SEMF_SLOT(m_onDataWrittenSlot, I2cBusScheduler, *this, onDataWritten);
+	/**Slot for onDataAvailable function.*/
+	SEMF_SLOT(m_onDataAvailableSlot, I2cBusScheduler, *this, onDataAvailable);
+	/**Slot for onError function.*/
+	SEMF_SLOT(m_onErrorSlot, I2cBusScheduler, *this, onError, Error);
+	/**Class ID for error tracing.*/
+	static constexpr Error::ClassID kSemfClassId = Error::ClassID::I2cBusScheduler;
+	/**I2cDevice is friend for registering and submitting.*/
+	friend class I2cDevice;
+};
+} /* namespace semf */
+#endif /* SEMF_COMMUNICATION_I2CBUSSCHEDULER_H_ */
@@ -0,0 +1,62 @@
+/**
+ * @file i2cdevice.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/communication/i2cbusscheduler.h>
+#include <semf/communication/i2cdevice.h>
+#include <semf/system/criticalsection.h>
+
+namespace semf
+{
+I2cDevice::I2cDevice(I2cBusScheduler& scheduler, uint8_t address, uint8_t priority)
+: m_scheduler(scheduler),
+  m_address(address),
+  m_priority(priority)
+{
+	m_scheduler.addDevice(*this);
+}
+
+I2cDevice::~I2cDevice()
+{
+	m_scheduler.removeDevice(*this);
+}
+
+void I2cDevice::submit(I2cTransaction& transaction)
+{
+	m_scheduler.submit(*this, transaction);
+}
+
+uint8_t I2cDevice::address() const
+{
+	return m_address;
+}
+
+void I2cDevice::setAddress(uint8_t address)
+{
+	CriticalSection::enter();
+	m_address = address;
+	CriticalSection::exit();
+}
+
+uint8_t I2cDevice::priority() const
+{
+	return m_priority;
+}
+
+void I2cDevice::setPriority(uint8_t priority)
+{
+	CriticalSection::enter();
+	m_priority = priority;
+	CriticalSection::exit();
+}
+
+size_t I2cDevice::queuedTransactions() const
+{
+	return m_queue.size();
+}
+} /* namespace semf */
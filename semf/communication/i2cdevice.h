@@ -0,0 +1,91 @@
+/**
+ * @file i2cdevice.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_COMMUNICATION_I2CDEVICE_H_
+#define SEMF_COMMUNICATION_I2CDEVICE_H_
+
+#include <semf/communication/i2ctransaction.h>
+#include <semf/utils/core/lists/linkedlist.h>
+#include <semf/utils/core/queues/linkedqueue.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+class I2cBusScheduler;
+/**
+ * @brief Handle of a device on an I2C bus shared by an \c I2cBusScheduler.
+ *
+ * Every device has its own queue of transactions, which are executed in submit order.
+ * Transactions of devices with higher priority are executed first, devices with the same priority take turns.
+ *
+ * @note \c LinkedList::Node has to be the first base class, because \c LinkedList casts its end element to \c I2cDevice.
+ * @note Destroying a device drops its queued transactions, their \c error signal is emitted. A transaction already
+ *       running on the bus is finished normally, so it has to outlive the device.
+ */
+class I2cDevice : public LinkedList<I2cDevice>::Node
+{
+public:
+	/**
+	 * @brief Constructor, registers the device at \c scheduler.
+	 * @param scheduler Scheduler of the bus the device is connected to.
+	 * @param address 7 bit I2C address of the device.
+	 * @param priority Priority of the device's transactions, higher values are executed first.
+	 */
+	I2cDevice(I2cBusScheduler& scheduler, uint8_t address, uint8_t priority = 0);
+	explicit I2cDevice(const I2cDevice& other) = delete;
+	/**Destructor, unregisters the device from the scheduler and drops its queued transactions.*/
+	virtual ~I2cDevice();
+
+	/**
+	 * @brief Appends \c transaction to the device's queue. The scheduler executes it as soon as the bus is free.
+	 * @param transaction Transaction to execute.
+	 * @see I2cBusScheduler::ErrorCode for the errors emitted by the \c error signal of \c transaction.
+	 */
+	void submit(I2cTransaction& transaction);
+	/**
+	 * @brief Returns the I2C address.
+	 * @return 7 bit I2C address.
+	 */
+	uint8_t address() const;
+	/**
+	 * @brief Sets the I2C address, used for all transactions started afterwards.
+	 * @param address 7 bit I2C address.
+	 */
+	void setAddress(uint8_t address);
+	/**
+	 * @brief Returns the priority.
+	 * @return Priority, higher values are executed first.
+	 */
+	uint8_t priority() const;
+	/**
+	 * @brief Sets the priority.
+	 * @param priority Priority, higher values are executed first.
+	 */
+	void setPriority(uint8_t priority);
+	/**
+	 * @brief Returns the number of transactions waiting in the device's queue.
+	 * @return Number of queued transactions, the transaction on the bus is not included.
+	 */
+	size_t queuedTransactions() const;
+
+private:
+	/**Scheduler of the bus.*/
+	I2cBusScheduler& m_scheduler;
+	/**7 bit I2C address.*/
+	uint8_t m_address;
+	/**Priority of the transactions.*/
+	uint8_t m_priority;
+	/**Transactions waiting for the bus.*/
+	LinkedQueue<I2cTransaction> m_queue;
+	/**I2cBusScheduler is friend for scheduling the queue.*/
+	friend class I2cBusScheduler;
+};
+} /* namespace semf */
+#endif /* SEMF_COMMUNICATION_I2CDEVICE_H_ */
@@ -0,0 +1,50 @@
+/**
+ * @file i2ctransaction.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/communication/i2ctransaction.h>
+
+namespace semf
+{
+void I2cTransaction::setWrite(const uint8_t data[], size_t dataSize)
+{
+	m_type = Type::Write;
+	m_writeData = data;
+	m_writeDataSize = dataSize;
+	m_readBuffer = nullptr;
+	m_readBufferSize = 0;
+}
+
+void I2cTransaction::setRead(uint8_t buffer[], size_t bufferSize)
+{
+	m_type = Type::Read;
+	m_writeData = nullptr;
+	m_writeDataSize = 0;
+	m_readBuffer = buffer;
+	m_readBufferSize = bufferSize;
+}
+
+void I2cTransaction::setWriteRead(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize)
+{
+	m_type = Type::WriteRead;
+	m_writeData = data;
+	m_writeDataSize = dataSize;
+	m_readBuffer = buffer;
+	m_readBufferSize = bufferSize;
+}
+
+I2cTransaction::Type I2cTransaction::type() const
+{
+	return m_type;
+}
+
+bool I2cTransaction::isPending() const
+{
+	return m_pending;
+}
+} /* namespace semf */
@@ -0,0 +1,96 @@
+/**
+ * @file i2ctransaction.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_COMMUNICATION_I2CTRANSACTION_H_
+#define SEMF_COMMUNICATION_I2CTRANSACTION_H_
+
+#include <semf/utils/core/error.h>
+#include <semf/utils/core/queues/linkedqueue.h>
+#include <semf/utils/core/signals/signal.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Transfer on an I2C bus, which is submitted by an \c I2cDevice to an \c I2cBusScheduler.
+ *
+ * A transaction is a write, a read or a write followed by a read with repeated start (e.g. register address and
+ * register data). The transaction only stores pointers to the data, so the data have to stay valid until
+ * \c finished or \c error is emitted. A transaction can be submitted again after it is finished.
+ */
+class I2cTransaction : public LinkedQueue<I2cTransaction>::Node
+{
+public:
+	/**Kind of transfer.*/
+	enum class Type : uint8_t
+	{
+		Write = 0,
+		Read,
+		WriteRead
+	};
+
+	I2cTransaction() = default;
+	explicit I2cTransaction(const I2cTransaction& other) = delete;
+	virtual ~I2cTransaction() = default;
+
+	/**
+	 * @brief Configures the transaction as write.
+	 * @param data Data to write.
+	 * @param dataSize Size of \c data.
+	 */
+	void setWrite(const uint8_t data[], size_t dataSize);
+	/**
+	 * @brief Configures the transaction as read.
+	 * @param buffer Buffer to store the read data in.
+	 * @param bufferSize Size of \c buffer.
+	 */
+	void setRead(uint8_t buffer[], size_t bufferSize);
+	/**
+	 * @brief Configures the transaction as write followed by a read with repeated start.
+	 * @param data Data to write.
+	 * @param dataSize Size of \c data.
+	 * @param buffer Buffer to store the read data in.
+	 * @param bufferSize Size of \c buffer.
+	 */
+	void setWriteRead(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize);
+	/**
+	 * @brief Returns the kind of transfer.
+	 * @return Type of the transaction.
+	 */
+	Type type() const;
+	/**
+	 * @brief Returns if the transaction is submitted and not finished yet.
+	 * @return \c true if pending, otherwise \c false.
+	 */
+	bool isPending() const;
+
+	/**Signal is emitted after the transaction is finished successfully.*/
+	Signal<> finished;
+	/**Signal is emitted if the transaction could not be submitted or failed on the bus.*/
+	Signal<Error> error;
+
+private:
+	/**Kind of transfer.*/
+	Type m_type = Type::Write;
+	/**Data to write.*/
+	const uint8_t* m_writeData = nullptr;
+	/**Size of the data to write.*/
+	size_t m_writeDataSize = 0;
+	/**Buffer for the read data.*/
+	uint8_t* m_readBuffer = nullptr;
+	/**Size of the read buffer.*/
+	size_t m_readBufferSize = 0;
+	/**Transaction is submitted and not finished yet.*/
+	bool m_pending = false;
+	/**I2cBusScheduler is friend for executing the transaction.*/
+	friend class I2cBusScheduler;
+};
+} /* namespace semf */
+#endif /* SEMF_COMMUNICATION_I2CTRANSACTION_H_ */
@@ -0,0 +1,219 @@
+/**
+ * @file streamprotocol.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/communication/streamprotocol.h>
+#include <semf/utils/core/debug.h>
+
+namespace semf
+{
+StreamProtocol::StreamProtocol(app::Communication& communication, app::Crc& crc, uint8_t receiveBuffer[], size_t receiveBufferSize,
+							   uint8_t transmitBuffer[], size_t transmitBufferSize)
+: m_communication(communication),
+  m_crc(crc),
+  m_receiveBuffer(receiveBuffer),
+  m_receiveBufferSize(receiveBufferSize),
+  m_transmitBuffer(transmitBuffer),
+  m_transmitBufferSize(transmitBufferSize)
+{
+	m_communication.dataAvailable.connect(m_onDataAvailableSlot);
+	m_communication.dataWritten.connect(m_onDataWrittenSlot);
+	m_communication.error.connect(m_onErrorSlot);
+}
+
+void StreamProtocol::write(const uint8_t data[], size_t dataSize)
+{
+	if (m_communication.isBusyWriting())
+	{
+		SEMF_ERROR("is busy");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Write_IsBusy)));
+		return;
+	}
+	size_t crcSize = m_crc.byteSize();
+	if (encodedSize(dataSize, crcSize) > m_transmitBufferSize)
+	{
+		SEMF_ERROR("frame too large");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Write_FrameTooLarge)));
+		return;
+	}
+
+	size_t codeIndex = 0;
+	size_t index = 1;
+	encode(data, dataSize, codeIndex, index);
+	encode(m_crc.calculate(data, dataSize), crcSize, codeIndex, index);
+	m_transmitBuffer[codeIndex] = static_cast<uint8_t>(index - codeIndex);
+	m_transmitBuffer[index++] = 0;
+
+	m_communication.write(m_transmitBuffer, index);
+}
+
+void StreamProtocol::startReceiving()
+{
+	resetDecoder();
+	m_receiving = true;
+	m_communication.read(&m_readByte, 1);
+}
+
+void StreamProtocol::startReceiving(UartHardware& uart, uint8_t buffer[], size_t bufferSize)
+{
+	resetDecoder();
+	m_receiving = true;
+	m_uart = &uart;
+	uart.dataReceived.connect(m_onDataReceivedSlot);
+	uart.startContinuousRead(buffer, bufferSize);
+}
+
+void StreamProtocol::stopReceiving()
+{
+	m_receiving = false;
+	if (m_uart != nullptr)
+	{
+		m_uart->dataReceived.disconnect(m_onDataReceivedSlot);
+		m_uart->stopRead();
+		m_uart = nullptr;
+	}
+	else
+	{
+		m_communication.stopRead();
+	}
+}
+
+void StreamProtocol::decode(const uint8_t data[], size_t dataSize)
+{
+	for (size_t i = 0; i < dataSize; i++)
+	{
+		uint8_t byte = data[i];
+		if (byte == 0)
+		{
+			finishFrame();
+		}
+		else if (m_blockRemaining == 0)
+		{
+			// Code byte: the previous block ended with a zero, except it was a full block without zero.
+			if (m_zeroPending)
+			{
+				if (m_frameSize < m_receiveBufferSize)
+					m_receiveBuffer[m_frameSize++] = 0;
+				else
+					m_overflow = true;
+			}
+			m_blockRemaining = static_cast<uint8_t>(byte - 1);
+			m_zeroPending = byte != 0xFF;
+		}
+		else
+		{
+			if (m_frameSize < m_receiveBufferSize)
+				m_receiveBuffer[m_frameSize++] = byte;
+			else
+				m_overflow = true;
+			m_blockRemaining--;
+		}
+	}
+}
+
+void StreamProtocol::resetDecoder()
+{
+	m_frameSize = 0;
+	m_blockRemaining = 0;
+	m_zeroPending = false;
+	m_overflow = false;
+}
+
+bool StreamProtocol::isReceiving() const
+{
+	return m_receiving;
+}
+
+bool StreamProtocol::isBusyWriting() const
+{
+	return m_communication.isBusyWriting();
+}
+
+void StreamProtocol::encode(const uint8_t data[], size_t dataSize, size_t& codeIndex, size_t& index)
+{
+	for (size_t i = 0; i < dataSize; i++)
+	{
+		if (data[i] == 0)
+		{
+			m_transmitBuffer[codeIndex] = static_cast<uint8_t>(index - codeIndex);
+			codeIndex = index++;
+		}
+		else
+		{
+			m_transmitBuffer[index++] = data[i];
+			if (index - codeIndex == 0xFF)
+			{
+				m_transmitBuffer[codeIndex] = 0xFF;
+				codeIndex = index++;
+			}
+		}
+	}
+}
+
+void StreamProtocol::finishFrame()
+{
+	size_t frameSize = m_frameSize;
+	bool overflow = m_overflow;
+	bool complete = m_blockRemaining == 0;
+	bool empty = frameSize == 0 && complete && !m_zeroPending && !overflow;
+	resetDecoder();
+
+	// Consecutive delimiters are allowed for synchronization.
+	if (empty)
+		return;
+
+	if (overflow)
+	{
+		SEMF_ERROR("frame too large");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_FrameTooLarge)));
+		return;
+	}
+	size_t crcSize = m_crc.byteSize();
+	if (!complete || frameSize < crcSize)
+	{
+		SEMF_ERROR("frame invalid");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_FrameInvalid)));
+		return;
+	}
+	size_t dataSize = frameSize - crcSize;
+	m_crc.calculate(m_receiveBuffer, dataSize);
+	if (!m_crc.isEqual(&m_receiveBuffer[dataSize]))
+	{
+		SEMF_ERROR("crc mismatch");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_CrcMismatch)));
+		return;
+	}
+	frameReceived(m_receiveBuffer, dataSize);
+}
+
+void StreamProtocol::onDataAvailable()
+{
+	if (!m_receiving || m_uart != nullptr)
+		return;
+
+	// Restart reading before decoding, so no byte gets lost while a frame is processed.
+	uint8_t byte = m_readByte;
+	m_communication.read(&m_readByte, 1);
+	decode(&byte, 1);
+}
+
+void StreamProtocol::onDataReceived(size_t size)
+{
+	(void)size;
+	uint8_t chunk[kReadChunkSize];
+	size_t chunkSize;
+	// m_uart is checked every time, because a slot of frameReceived may stop receiving.
+	while (m_uart != nullptr && (chunkSize = m_uart->readAvailable(chunk, sizeof(chunk))) > 0)
+		decode(chunk, chunkSize);
+}
+
+void StreamProtocol::onDataWritten()
+{
+	frameWritten();
+}
+} /* namespace semf */
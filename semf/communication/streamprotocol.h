@@ -0,0 +1,202 @@
+/**
+ * @file streamprotocol.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_COMMUNICATION_STREAMPROTOCOL_H_
+#define SEMF_COMMUNICATION_STREAMPROTOCOL_H_
+
+#include <semf/app/communication/communication.h>
+#include <semf/app/processing/crc.h>
+#include <semf/communication/uarthardware.h>
+#include <semf/utils/core/error.h>
+#include <semf/utils/core/signals/signal.h>
+#include <semf/utils/core/signals/slot.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Frame based protocol for byte streams like UART, using COBS (consistent overhead byte stuffing) and a CRC.
+ *
+ * A frame consists of the payload followed by the CRC calculated with \c crc over the payload. The frame is COBS
+ * encoded, so it does not contain any zero byte, and terminated by a zero byte as delimiter. The encoding overhead
+ * is one byte per started 254 bytes plus the delimiter, see \c encodedSize().
+ *
+ * Received data is decoded incrementally with constant work per byte straight into the receive buffer.
+ * Only whole frames with a correct CRC are delivered by the \c frameReceived signal, corrupted frames are dropped
+ * with an \c error signal and the decoder synchronizes on the next delimiter.
+ *
+ * For receiving, \c startReceiving(UartHardware&, uint8_t[], size_t) lets the UART receive continuously into a circular
+ * buffer, e.g. by circular DMA, and decodes all new bytes at once on every \c dataReceived signal. This is the
+ * intended receive path. Data received by other means can be passed to \c decode() directly.
+ * \c startReceiving() without parameters reads the stream byte by byte by the \c Communication, which costs one read
+ * and one \c dataAvailable signal per byte. It is only a fallback for low data rates or hardware without continuous
+ * reception.
+ *
+ * @note The receive buffer has to hold the payload and the CRC of the biggest frame.
+ * The transmit buffer has to hold the encoded frame, see \c encodedSize().
+ */
+class StreamProtocol
+{
+public:
+	/**
+	 * @brief Error codes for this class. Error ID identify a unique error() / onError call (excluding transferring).
+	 */
+	enum class ErrorCode : uint8_t
+	{
+		Write_IsBusy = 0,
+		Write_FrameTooLarge,
+		Decode_FrameTooLarge,
+		Decode_FrameInvalid,
+		Decode_CrcMismatch
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param communication Communication to transmit and receive the stream with.
+	 * @param crc CRC for securing the frames.
+	 * @param receiveBuffer Buffer for a decoded frame including the CRC.
+	 * @param receiveBufferSize Size of \c receiveBuffer.
+	 * @param transmitBuffer Buffer for an encoded frame.
+	 * @param transmitBufferSize Size of \c transmitBuffer.
+	 */
+	StreamProtocol(app::Communication& communication, app::Crc& crc, uint8_t receiveBuffer[], size_t receiveBufferSize, uint8_t transmitBuffer[],
+				   size_t transmitBufferSize);
+	explicit StreamProtocol(const StreamProtocol& other) = delete;
+	virtual ~StreamProtocol() = default;
+
+	/**
+	 * @brief Encodes \c data as frame and writes it. The \c frameWritten signal is emitted after successful write.
+	 * @param data Payload of the frame.
+	 * @param dataSize Size of the payload.
+	 * @throws Write_IsBusy If the communication is busy writing.
+	 * @throws Write_FrameTooLarge If the encoded frame does not fit into the transmit buffer.
+	 */
+	void write(const uint8_t data[], size_t dataSize);
+	/**
+	 * @brief Starts reading the stream byte by byte from the communication. Every received frame is emitted by
+	 * \c frameReceived.
+	 * @note Fallback for low data rates, every byte costs one read and one \c dataAvailable signal.
+	 * @note A partly received frame is discarded.
+	 */
+	void startReceiving();
+	/**
+	 * @brief Starts reading the stream continuously from \c uart into the circular \c buffer. All new bytes are decoded
+	 * at once on every \c dataReceived signal of \c uart. Every received frame is emitted by \c frameReceived.
+	 * @note \c uart is usually the communication of this protocol, otherwise its errors are not forwarded.
+	 * @note A partly received frame is discarded.
+	 * @param uart UART receiving the stream.
+	 * @param buffer Circular receive buffer for \c UartHardware::startContinuousRead().
+	 * @param bufferSize Size of \c buffer.
+	 */
+	void startReceiving(UartHardware& uart, uint8_t buffer[], size_t bufferSize);
+	/**Stops reading the stream.*/
+	void stopReceiving();
+	/**
+	 * @brief Decodes received stream data. Every complete frame is emitted by \c frameReceived.
+	 * @note Use this function if the stream is not read by \c startReceiving().
+	 * @param data Received stream data.
+	 * @param dataSize Size of \c data.
+	 * @throws Decode_FrameTooLarge If a frame does not fit into the receive buffer.
+	 * @throws Decode_FrameInvalid If a frame ends inside of a COBS block or is shorter than the CRC.
+	 * @throws Decode_CrcMismatch If the CRC of a frame is wrong.
+	 */
+	void decode(const uint8_t data[], size_t dataSize);
+	/**Discards a partly decoded frame.*/
+	void resetDecoder();
+	/**
+	 * @brief Returns if the stream is read from the communication.
+	 * @return \c true if receiving, otherwise \c false.
+	 */
+	bool isReceiving() const;
+	/**
+	 * @brief Returns if a frame is written at the moment.
+	 * @return \c true if busy writing, otherwise \c false.
+	 */
+	bool isBusyWriting() const;
+	/**
+	 * @brief Returns the size of an encoded frame including CRC and delimiter.
+	 * @param dataSize Size of the payload.
+	 * @param crcSize Size of the CRC in bytes.
+	 * @return Size of the encoded frame.
+	 */
+	static constexpr size_t encodedSize(size_t dataSize, size_t crcSize)
+	{
+		return dataSize + crcSize + (dataSize + crcSize) / 254 + 2;
+	}
+
+	/**Signal is emitted after a frame with correct CRC is received. It delivers the payload and its size.*/
+	Signal<const uint8_t*, size_t> frameReceived;
+	/**Signal is emitted after a frame is written.*/
+	Signal<> frameWritten;
+	/**Signal is emitted if any error happens in this class or in the communication.*/
+	Signal<Error> error;
+
+private:
+	/**
+	 * @brief Encodes \c data into the transmit buffer, continuing the current COBS block.
+	 * @param data Data to encode.
+	 * @param dataSize Size of \c data.
+	 * @param codeIndex Index of the code byte of the current block.
+	 * @param index Index for the next byte.
+	 */
+	void encode(const uint8_t data[], size_t dataSize, size_t& codeIndex, size_t& index);
+	/**Checks the CRC of a completely decoded frame and emits it.*/
+	void finishFrame();
+	/**Slot for the \c dataAvailable signal of the communication.*/
+	void onDataAvailable();
+	/**
+	 * @brief Slot for the \c dataReceived signal of the UART receiving continuously.
+	 * @param size Number of new bytes.
+	 */
+	void onDataReceived(size_t size);
+	/**Slot for the \c dataWritten signal of the communication.*/
+	void onDataWritten();
+
+	/**Communication to transmit and receive with.*/
+	app::Communication& m_communication;
+	/**CRC for the frames.*/
+	app::Crc& m_crc;
+	/**Buffer for the decoded frame.*/
+	uint8_t* const m_receiveBuffer;
+	/**Size of the receive buffer.*/
+	const size_t m_receiveBufferSize;
+	/**Buffer for the encoded frame.*/
+	uint8_t* const m_transmitBuffer;
+	/**Size of the transmit buffer.*/
+	const size_t m_transmitBufferSize;
+	/**Byte read from the communication.*/
+	uint8_t m_readByte = 0;
+	/**UART receiving continuously, \c nullptr while reading byte by byte.*/
+	UartHardware* m_uart = nullptr;
+	/**Size of the decoded part of the current frame.*/
+	size_t m_frameSize = 0;
+	/**Remaining data bytes of the current COBS block.*/
+	uint8_t m_blockRemaining = 0;
+	/**A zero byte has to be inserted before the next block.*/
+	bool m_zeroPending = false;
+	/**The current frame does not fit into the receive buffer.*/
+	bool m_overflow = false;
+	/**Stream is read from the communication.*/
+	bool m_receiving = false;
+	/**Slot for onDataAvailable function.*/
+	SEMF_SLOT(m_onDataAvailableSlot, StreamProtocol, *this, onDataAvailable);
+	/**Slot for onDataReceived function.*/
+	SEMF_SLOT(m_onDataReceivedSlot, StreamProtocol, *this, onDataReceived, size_t);
+	/**Slot for onDataWritten function.*/
+	SEMF_SLOT(m_onDataWrittenSlot, StreamProtocol, *this, onDataWritten);
+	/**Slot for forwarding errors of the communication.*/
+	SEMF_SLOT(m_onErrorSlot, Signal<Error>, error, emitSignal, Error);
+	/**Number of bytes taken from the circular receive buffer at once.*/
+	static constexpr size_t kReadChunkSize = 32;
+	/**Class ID for error tracing.*/
+	static constexpr Error::ClassID kSemfClassId = Error::ClassID::StreamProtocol;
+};
+} /* namespace semf */
+#endif /* SEMF_COMMUNICATION_STREAMPROTOCOL_H_ */
@@ -8,20 +8,16 @@
  */
 
 #include <semf/communication/uarthardware.h>
+#include <semf/system/criticalsection.h>
 #include <semf/utils/core/debug.h>
 #include <cstdint>
+#include <cstring>
 
 namespace semf
 {
 void UartHardware::write(const uint8_t data[], size_t dataSize)
 {
 	SEMF_INFO("data %p, dataSize is %u", data, dataSize);
-	if (m_isBusyWriting)
-	{
-		SEMF_ERROR("is busy");
-		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Write_IsBusy)));
-		return;
-	}
 	if (data == nullptr)
 	{
 		SEMF_ERROR("data is nullptr");
@@ -35,8 +31,57 @@ void UartHardware::write(const uint8_t data[], size_t dataSize)
 		return;
 	}
 
+	Segment segment = {data, dataSize};
+	writeSegments(&segment, 1);
+}
+
+void UartHardware::writeSegments(const Segment segments[], size_t count)
+{
+	SEMF_INFO("segments %p, count is %u", segments, count);
+	size_t used = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (segments[i].size == 0)
+			continue;
+		if (segments[i].data == nullptr)
+		{
+			SEMF_ERROR("data is nullptr");
+			error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Write_DataIsNullptr)));
+			return;
+		}
+		used++;
+	}
+	if (used == 0)
+	{
+		SEMF_ERROR("dataSize is 0");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Write_DataSizeIsZero)));
+		return;
+	}
+
+	CriticalSection::enter();
+	if (used > kWriteQueueSize - m_queueCount)
+	{
+		CriticalSection::exit();
+		SEMF_ERROR("is busy");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Write_IsBusy)));
+		return;
+	}
+	size_t index = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (segments[i].size == 0)
+			continue;
+		index = (m_queueHead + m_queueCount++) % kWriteQueueSize;
+		m_queue[index] = {segments[i].data, segments[i].size, false};
+	}
+	m_queue[index].last = true;
+	bool start = !m_isBusyWriting;
 	m_isBusyWriting = true;
-	writeHardware(data, dataSize);
+	QueueEntry first = m_queue[m_queueHead];
+	CriticalSection::exit();
+
+	if (start)
+		writeHardware(first.data, first.size);
 }
 
 void UartHardware::read(uint8_t buffer[], size_t bufferSize)
@@ -65,6 +110,76 @@ void UartHardware::read(uint8_t buffer[], size_t bufferSize)
 	readHardware(buffer, bufferSize);
 }
 
+void UartHardware::startContinuousRead(uint8_t buffer[], size_t bufferSize)
+{
+	SEMF_INFO("buffer %p, bufferSize is %u", buffer, bufferSize);
+	if (m_isBusyReading)
+	{
+		SEMF_ERROR("is busy");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Read_IsBusy)));
+		return;
+	}
+	if (buffer == nullptr)
+	{
+		SEMF_ERROR("data is nullptr");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Read_BufferIsNullptr)));
+		return;
+	}
+	if (bufferSize == 0)
+	{
+		SEMF_ERROR("dataSize is 0");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Read_BufferSizeIsZero)));
+		return;
+	}
+
+	m_rxBuffer = buffer;
+	m_rxBufferSize = bufferSize;
+	m_rxPosition = 0;
+	m_rxReadIndex = 0;
+	m_rxReadCounter = 0;
+	m_rxWriteCounter.store(0, std::memory_order_release);
+	m_isReadingContinuous = true;
+	m_isBusyReading = true;
+	readContinuousHardware(buffer, bufferSize);
+}
+
+bool UartHardware::isReadingContinuous() const
+{
+	return m_isReadingContinuous;
+}
+
+size_t UartHardware::available() const
+{
+	return m_rxWriteCounter.load(std::memory_order_acquire) - m_rxReadCounter;
+}
+
+size_t UartHardware::readAvailable(uint8_t buffer[], size_t bufferSize)
+{
+	size_t write = m_rxWriteCounter.load(std::memory_order_acquire);
+	size_t count = write - m_rxReadCounter;
+	if (count > m_rxBufferSize)
+	{
+		m_rxReadIndex = (m_rxReadIndex + count % m_rxBufferSize) % m_rxBufferSize;
+		m_rxReadCounter = write;
+		SEMF_ERROR("overrun");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::ReadContinuous_Overrun)));
+		return 0;
+	}
+	if (count > bufferSize)
+		count = bufferSize;
+	if (count == 0)
+		return 0;
+
+	size_t first = m_rxBufferSize - m_rxReadIndex < count ? m_rxBufferSize - m_rxReadIndex : count;
+	std::memcpy(buffer, &m_rxBuffer[m_rxReadIndex], first);
+	std::memcpy(&buffer[first], m_rxBuffer, count - first);
+	m_rxReadIndex = first < count ? count - first : m_rxReadIndex + count;
+	if (m_rxReadIndex == m_rxBufferSize)
+		m_rxReadIndex = 0;
+	m_rxReadCounter += count;
+	return count;
+}
+
 bool UartHardware::isBusyReading() const
 {
 	return m_isBusyReading;
@@ -75,21 +190,58 @@ bool UartHardware::isBusyWriting() const
 	return m_isBusyWriting;
 }
 
+size_t UartHardware::writeQueueSpace() const
+{
+	return kWriteQueueSize - m_queueCount;
+}
+
 void UartHardware::setBusyReading(bool isBusy)
 {
 	m_isBusyReading = isBusy;
+	if (!isBusy)
+		m_isReadingContinuous = false;
+}
+
+void UartHardware::readContinuousHardware(uint8_t buffer[], size_t bufferSize)
+{
+	(void)buffer;
+	(void)bufferSize;
+	SEMF_ERROR("continuous read not supported");
+	onError(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::ReadContinuous_NotSupported)));
 }
 
 void UartHardware::setBusyWriting(bool isBusy)
 {
+	CriticalSection::enter();
 	m_isBusyWriting = isBusy;
+	if (!isBusy)
+		m_queueCount = 0;
+	CriticalSection::exit();
 }
 
 void UartHardware::onDataWritten()
 {
-	m_isBusyWriting = false;
-	SEMF_INFO("data written");
-	dataWritten();
+	CriticalSection::enter();
+	bool last = true;
+	if (m_queueCount > 0)
+	{
+		last = m_queue[m_queueHead].last;
+		m_queueHead = (m_queueHead + 1) % kWriteQueueSize;
+		m_queueCount--;
+	}
+	bool next = m_queueCount > 0;
+	m_isBusyWriting = next;
+	QueueEntry entry = m_queue[m_queueHead];
+	CriticalSection::exit();
+
+	// Start the next segment first to keep the gap between the transfers short.
+	if (next)
+		writeHardware(entry.data, entry.size);
+	if (last)
+	{
+		SEMF_INFO("data written");
+		dataWritten();
+	}
 }
 
 void UartHardware::onDataAvailable()
@@ -99,10 +251,25 @@ void UartHardware::onDataAvailable()
 	dataAvailable();
 }
 
+void UartHardware::onDataReceived(size_t position)
+{
+	if (!m_isReadingContinuous)
+		return;
+
+	// position is in [0, size], so a full buffer since the last event is not mistaken for no data.
+	size_t count = position >= m_rxPosition ? position - m_rxPosition : position + m_rxBufferSize - m_rxPosition;
+	m_rxPosition = position % m_rxBufferSize;
+	if (count == 0)
+		return;
+
+	m_rxWriteCounter.store(m_rxWriteCounter.load(std::memory_order_relaxed) + count, std::memory_order_release);
+	dataReceived(count);
+}
+
 void UartHardware::onError(Error thrown)
 {
-	m_isBusyReading = false;
-	m_isBusyWriting = false;
+	setBusyReading(false);
+	setBusyWriting(false);
 	SEMF_ERROR("error");
 	error(thrown);
 }
@@ -12,11 +12,34 @@
 
 #include <semf/communication/communicationhardwareasynchronous.h>
 #include <semf/communication/uart.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**Number of segments the write queue of \c UartHardware can hold.*/
+#ifndef SEMF_UARTHARDWARE_WRITE_QUEUE_SIZE
+#define SEMF_UARTHARDWARE_WRITE_QUEUE_SIZE 8
+#endif
 
 namespace semf
 {
 /**
  * @brief Class for using UART hardware
+ *
+ * Writes are queued: calling \c write() or \c writeSegments() while a transfer is active appends the data to the
+ * write queue, which is transferred from \c onDataWritten() directly after the active transfer. The queue only
+ * stores pointer and size of every segment, so the data have to stay valid until the \c dataWritten signal of the
+ * write is emitted. The \c dataWritten signal is emitted once per \c write() or \c writeSegments() call.
+ *
+ * The queue holds \c SEMF_UARTHARDWARE_WRITE_QUEUE_SIZE segments, the active transfer included.
+ * It is cleared by \c stopWrite() and on an error.
+ *
+ * Besides the one-shot \c read(), \c startContinuousRead() lets the hardware receive into a circular buffer without
+ * stopping, e.g. by circular DMA. On half, full and idle-line events the hardware reports its position and the
+ * \c dataReceived signal is emitted with the number of new bytes. The consumer reads them by \c readAvailable(),
+ * which is lock-free for one consumer context. \c stopRead() ends the continuous reception.
+ *
+ * @note For using \c UartHardware a global \c CriticalSection object is required.
  */
 class UartHardware : public Uart, public CommunicationHardwareAsynchronous
 {
@@ -31,20 +54,47 @@ public:
 		Write_DataSizeIsZero,
 		Read_IsBusy,
 		Read_BufferIsNullptr,
-		Read_BufferSizeIsZero
+		Read_BufferSizeIsZero,
+		ReadContinuous_NotSupported,
+		ReadContinuous_Overrun
 	};
 
+	/**
+	 * @brief Part of the data of one write, e.g. header, payload or CRC of a frame.
+	 */
+	struct Segment
+	{
+		/**Data of the segment.*/
+		const uint8_t* data;
+		/**Size of the data.*/
+		size_t size;
+	};
+	/**Number of segments the write queue can hold.*/
+	static constexpr size_t kWriteQueueSize = SEMF_UARTHARDWARE_WRITE_QUEUE_SIZE;
+
 	UartHardware() = default;
 	explicit UartHardware(const UartHardware& other) = delete;
 	virtual ~UartHardware() = default;
 
 	/**
 	 * @copydoc CommunicationHardwareAsynchronous::write()
-	 * @throws Write_IsBusy If this is busy.
+	 * @note If a transfer is active, \c data is queued and has to stay valid until \c dataWritten is emitted.
+	 * @throws Write_IsBusy If the write queue is full.
 	 * @throws Write_DataIsNullptr If data is a nullptr.
 	 * @throws Write_DataSizeIsZero If dataSize is zero.
 	 */
 	void write(const uint8_t data[], size_t dataSize) override;
+	/**
+	 * @brief Writes several segments back-to-back without copying them into one buffer.
+	 * The \c dataWritten signal is emitted once after the last segment is written.
+	 * @note The segments' data has to stay valid until \c dataWritten is emitted, the \c segments array itself not.
+	 * @param segments Segments to write, segments with size zero are skipped.
+	 * @param count Number of segments.
+	 * @throws Write_IsBusy If the write queue has not enough free space for the segments.
+	 * @throws Write_DataIsNullptr If data of a segment is a nullptr.
+	 * @throws Write_DataSizeIsZero If the total size of the segments is zero.
+	 */
+	void writeSegments(const Segment segments[], size_t count);
 	/**
 	 * @copydoc CommunicationHardwareAsynchronous::read()
 	 * @throws Read_IsBusy If this is busy.
@@ -52,8 +102,48 @@ public:
 	 * @throws Read_BufferSizeIsZero If bufferSize is zero.
 	 */
 	void read(uint8_t buffer[], size_t bufferSize) override;
+	/**
+	 * @brief Starts receiving continuously into the circular \c buffer until \c stopRead() is called.
+	 * The \c dataReceived signal is emitted every time the hardware reports new bytes.
+	 * @note \c buffer has to be big enough to hold all bytes received until the consumer reads them.
+	 * @param buffer Circular receive buffer.
+	 * @param bufferSize Size of \c buffer.
+	 * @throws Read_IsBusy If this is busy.
+	 * @throws Read_BufferIsNullptr If buffer is a nullptr.
+	 * @throws Read_BufferSizeIsZero If bufferSize is zero.
+	 * @throws ReadContinuous_NotSupported If the hardware does not support continuous reception.
+	 */
+	void startContinuousRead(uint8_t buffer[], size_t bufferSize);
+	/**
+	 * @brief Returns if the hardware is receiving continuously.
+	 * @return \c true if receiving continuously, otherwise \c false.
+	 */
+	bool isReadingContinuous() const;
+	/**
+	 * @brief Returns the number of continuously received bytes not read yet.
+	 * @note Must only be called from the consumer context.
+	 * @return Number of bytes.
+	 */
+	size_t available() const;
+	/**
+	 * @brief Reads and removes continuously received bytes.
+	 * @note Must only be called from the consumer context.
+	 * @param buffer Buffer to copy the bytes into.
+	 * @param bufferSize Size of \c buffer.
+	 * @return Number of bytes copied into \c buffer.
+	 * @throws ReadContinuous_Overrun If the hardware has overwritten bytes not read yet. All received bytes are dropped.
+	 */
+	size_t readAvailable(uint8_t buffer[], size_t bufferSize);
 	bool isBusyReading() const override;
 	bool isBusyWriting() const override;
+	/**
+	 * @brief Returns the number of free segments in the write queue.
+	 * @return Free segments.
+	 */
+	size_t writeQueueSpace() const;
+
+	/**Signal is emitted while receiving continuously, if the hardware received new bytes. It delivers the number of new bytes.*/
+	Signal<size_t> dataReceived;
 
 protected:
 	/**
@@ -61,6 +151,7 @@ protected:
 	 * @note in the functions \c write(), \c read()
 	 * busy is set to \c true. In \c onDataAvailable(), \c onDataWritten()
 	 * and \c onError() is busy reseted to \c false.
+	 * Resetting busy ends the continuous reception, e.g. in \c stopRead().
 	 * @param isBusy \c true for busy, \c false for idle.
 	 */
 	void setBusyReading(bool isBusy);
@@ -69,6 +160,7 @@ protected:
 	 * @note in the functions \c write(), \c read()
 	 * busy is set to \c true. In \c onDataAvailable(), \c onDataWritten()
 	 * and \c onError() is busy reseted to \c false.
+	 * Resetting busy clears the write queue, e.g. in \c stopWrite().
 	 * @param isBusy \c true for busy, \c false for idle.
 	 */
 	void setBusyWriting(bool isBusy);
@@ -84,10 +176,27 @@ protected:
 	 * @param bufferSize data array size.
 	 */
 	virtual void readHardware(uint8_t buffer[], size_t bufferSize) = 0;
-	/**Is called after data are written by the hardware. Will emit \c dataWritten signal.*/
+	/**
+	 * @brief Hardware will receive continuously into the circular \c buffer and calls \c onDataReceived()
+	 * on half, full and idle-line events.
+	 * @note The default implementation reports \c ReadContinuous_NotSupported.
+	 * @param buffer Circular receive buffer.
+	 * @param bufferSize Size of \c buffer.
+	 */
+	virtual void readContinuousHardware(uint8_t buffer[], size_t bufferSize);
+	/**
+	 * @brief Is called after data are written by the hardware. Starts the next queued segment and
+	 * emits the \c dataWritten signal if the written segment was the last one of a write.
+	 */
 	void onDataWritten();
 	/**Is called after data is available in the hardware. Will emit \c dataAvailable signal.*/
 	void onDataAvailable();
+	/**
+	 * @brief Is called while receiving continuously on half, full and idle-line events.
+	 * Will emit \c dataReceived signal with the number of new bytes.
+	 * @param position Index in the circular buffer behind the last received byte, from 0 to the buffer size.
+	 */
+	void onDataReceived(size_t position);
 	/**
 	 * @brief Is called if an error occurred by hardware read or write access.
 	 * Will throw \c error signal.
@@ -96,6 +205,39 @@ protected:
 	void onError(Error thrown);
 
 private:
+	/**
+	 * @brief Queued segment.
+	 */
+	struct QueueEntry
+	{
+		/**Data of the segment.*/
+		const uint8_t* data;
+		/**Size of the data.*/
+		size_t size;
+		/**Last segment of a write, \c dataWritten is emitted after it.*/
+		bool last;
+	};
+
+	/**Write queue, the segment at \c m_queueHead is transferred at the moment.*/
+	QueueEntry m_queue[kWriteQueueSize];
+	/**Index of the first segment in the write queue.*/
+	size_t m_queueHead = 0;
+	/**Number of segments in the write queue.*/
+	size_t m_queueCount = 0;
+	/**Circular buffer for continuous reception.*/
+	uint8_t* m_rxBuffer = nullptr;
+	/**Size of the circular buffer.*/
+	size_t m_rxBufferSize = 0;
+	/**Last position reported by the hardware.*/
+	size_t m_rxPosition = 0;
+	/**Index of the next byte to read in the circular buffer, written by the consumer context only.*/
+	size_t m_rxReadIndex = 0;
+	/**Free-running count of continuously received bytes for the fill level, written by the hardware context only.*/
+	std::atomic<size_t> m_rxWriteCounter{0};
+	/**Free-running count of read bytes for the fill level, written by the consumer context only.*/
+	size_t m_rxReadCounter = 0;
+	/**Flag for hardware is receiving continuously.*/
+	bool m_isReadingContinuous = false;
 	/**Flag for hardware is busy reading.*/
 	bool m_isBusyReading = false;
 	/**Flag for hardware is busy writing.*/
@@ -19,6 +19,12 @@ extern "C" void HAL_UART_RxCpltCallback(UART_HandleTypeDef* huart)
 {
 	semf::Stm32Uart::systemIsrRead(*huart);
 }
+#if defined(HAL_UART_RECEPTION_TOIDLE)
+extern "C" void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef* huart, uint16_t Size)
+{
+	semf::Stm32Uart::systemIsrReceived(*huart, Size);
+}
+#endif
 
 namespace semf
 {
@@ -323,6 +329,12 @@ void Stm32Uart::systemIsrWritten(UART_HandleTypeDef& uart)
 		i.isrWritten(uart);
 }
 
+void Stm32Uart::systemIsrReceived(UART_HandleTypeDef& uart, uint16_t position)
+{
+	for (Stm32Uart& i : *(queue()))
+		i.isrReceived(uart, position);
+}
+
 void Stm32Uart::isrRead(UART_HandleTypeDef& uart)
 {
 	if (m_hwHandle == &uart)
@@ -339,6 +351,14 @@ void Stm32Uart::isrWritten(UART_HandleTypeDef& uart)
 	}
 }
 
+void Stm32Uart::isrReceived(UART_HandleTypeDef& uart, uint16_t position)
+{
+	if (m_hwHandle == &uart)
+	{
+		onDataReceived(position);
+	}
+}
+
 void Stm32Uart::writeHardware(const uint8_t data[], size_t dataSize)
 {
 	__HAL_UNLOCK(m_hwHandle);
@@ -389,6 +409,33 @@ void Stm32Uart::readHardware(uint8_t buffer[], size_t bufferSize)
 	}
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED) && defined(HAL_UART_RECEPTION_TOIDLE)
+void Stm32Uart::readContinuousHardware(uint8_t buffer[], size_t bufferSize)
+{
+	__HAL_UNLOCK(m_hwHandle);
+	HAL_StatusTypeDef state = HAL_UARTEx_ReceiveToIdle_DMA(m_hwHandle, buffer, static_cast<uint16_t>(bufferSize));
+	if (state != HAL_OK)
+	{
+		if (state == HAL_ERROR)
+		{
+			SEMF_ERROR("hal error");
+			onError(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::ReadContinuousHardware_HalError)));
+		}
+		else if (state == HAL_BUSY)
+		{
+			SEMF_ERROR("hal busy");
+			onError(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::ReadContinuousHardware_HalBusy)));
+		}
+		else if (state == HAL_TIMEOUT)
+		{
+			SEMF_ERROR("hal timeout");
+			onError(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::ReadContinuousHardware_HalTimeout)));
+		}
+		return;
+	}
+}
+#endif
+
 HAL_StatusTypeDef Stm32Uart::halLock()
 {
 	__HAL_LOCK(m_hwHandle);
@@ -19,6 +19,9 @@ namespace semf
 {
 /**
  * @brief \c UartHardware implemenation for STM32.
+ *
+ * Continuous reception by \c startContinuousRead() uses \c HAL_UARTEx_ReceiveToIdle_DMA(). It requires a HAL with
+ * reception to idle support and a receive DMA channel configured in circular mode.
  */
 class Stm32Uart : public UartHardware, public LinkedQueue<Stm32Uart>::Node
 {
@@ -51,6 +54,9 @@ public:
 		ReadHardware_HalBusy,
 		ReadHardware_HalTimeout,
 		SetFormat_DirectionInvalid,
+		ReadContinuousHardware_HalError,
+		ReadContinuousHardware_HalBusy,
+		ReadContinuousHardware_HalTimeout,
 	};
 
 	/**
@@ -128,6 +134,12 @@ public:
 	 * @param uart Hardware handler.
 	 */
 	static void systemIsrWritten(UART_HandleTypeDef& uart);
+	/**
+	 * @brief System-wide interrupt service routine for uart continuous receive events (half, full and idle-line).
+	 * @param uart Hardware handler.
+	 * @param position Position in the receive buffer behind the last received byte.
+	 */
+	static void systemIsrReceived(UART_HandleTypeDef& uart, uint16_t position);
 	/**
 	 * @brief Interrupt service routine for uart object receive.
 	 * @param uart Hardware handler.
@@ -138,6 +150,12 @@ public:
 	 * @param uart Hardware handler.
 	 */
 	void isrWritten(UART_HandleTypeDef& uart);
+	/**
+	 * @brief Interrupt service routine for uart object continuous receive events (half, full and idle-line).
+	 * @param uart Hardware handler.
+	 * @param position Position in the receive buffer behind the last received byte.
+	 */
+	void isrReceived(UART_HandleTypeDef& uart, uint16_t position);
 
 protected:
 	/**
@@ -154,6 +172,15 @@ protected:
 	 * @throws ReadHardware_HalTimeout If the ST-HAL returns a hal timeout.
 	 */
 	void readHardware(uint8_t buffer[], size_t bufferSize) override;
+#if defined(HAL_DMA_MODULE_ENABLED) && defined(HAL_UART_RECEPTION_TOIDLE)
+	/**
+	 * @copydoc UartHardware::readContinuousHardware()
+	 * @throws ReadContinuousHardware_HalError If the ST-HAL returns a hal error.
+	 * @throws ReadContinuousHardware_HalBusy If the ST-HAL returns a hal bussy.
+	 * @throws ReadContinuousHardware_HalTimeout If the ST-HAL returns a hal timeout.
+	 */
+	void readContinuousHardware(uint8_t buffer[], size_t bufferSize) override;
+#endif
 
 private:
 	/**
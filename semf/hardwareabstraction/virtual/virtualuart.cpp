@@ -0,0 +1,177 @@
+/**
+ * @file virtualuart.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/hardwareabstraction/virtual/virtualuart.h>
+#include <cstring>
+
+namespace semf
+{
+VirtualUart::VirtualUart(uint32_t baud)
+: m_baud(baud)
+{
+}
+
+void VirtualUart::init()
+{
+}
+
+void VirtualUart::deinit()
+{
+}
+
+void VirtualUart::stopWrite()
+{
+	m_writeRemaining = 0;
+	setBusyWriting(false);
+	writeStopped();
+}
+
+void VirtualUart::stopRead()
+{
+	m_readBuffer = nullptr;
+	m_readContinuous = false;
+	setBusyReading(false);
+	readStopped();
+}
+
+void VirtualUart::setFormat(uint8_t bits, Parity par, StopBits stop, FlowControl flow)
+{
+	(void)flow;
+	uint32_t stopHalfBits = 2;
+	if (stop == StopBits::Stopbits_0_5)
+		stopHalfBits = 1;
+	else if (stop == StopBits::Stopbits_1_5)
+		stopHalfBits = 3;
+	else if (stop == StopBits::Stopbits_2)
+		stopHalfBits = 4;
+	m_frameHalfBits = 2 * (1 + bits + (par == Parity::NoParity ? 0 : 1)) + stopHalfBits;
+}
+
+void VirtualUart::setWireMode(WireMode mode)
+{
+	(void)mode;
+}
+
+void VirtualUart::setDirection(Direction direction)
+{
+	(void)direction;
+}
+
+void VirtualUart::setBaud(uint32_t baud)
+{
+	m_baud = baud;
+}
+
+uint32_t VirtualUart::baud()
+{
+	return m_baud;
+}
+
+void VirtualUart::connect(VirtualUart& peer)
+{
+	m_peer = &peer;
+}
+
+void VirtualUart::elapse(uint32_t microseconds)
+{
+	uint64_t time = static_cast<uint64_t>(microseconds) * m_baud * 2 + m_timeRemainder;
+	uint64_t byteTime = static_cast<uint64_t>(m_frameHalfBits) * 1000000;
+	size_t bytes = static_cast<size_t>(time / byteTime);
+	m_timeRemainder = time % byteTime;
+
+	while (bytes > 0 && m_writeRemaining > 0)
+	{
+		size_t count = bytes < m_writeRemaining ? bytes : m_writeRemaining;
+		const uint8_t* data = m_writeData;
+		m_writeData += count;
+		m_writeRemaining -= count;
+		bytes -= count;
+		if (m_peer != nullptr)
+			m_peer->receive(data, count);
+		// Can start the next transfer by writeHardware().
+		if (m_writeRemaining == 0)
+			onDataWritten();
+	}
+
+	// The line was idle for at least one frame.
+	if (bytes > 0 && m_peer != nullptr)
+		m_peer->receiveIdle();
+}
+
+size_t VirtualUart::droppedBytes() const
+{
+	return m_droppedBytes;
+}
+
+void VirtualUart::writeHardware(const uint8_t data[], size_t dataSize)
+{
+	m_writeData = data;
+	m_writeRemaining = dataSize;
+}
+
+void VirtualUart::readHardware(uint8_t buffer[], size_t bufferSize)
+{
+	m_readBuffer = buffer;
+	m_readBufferSize = bufferSize;
+	m_readIndex = 0;
+	m_readContinuous = false;
+}
+
+void VirtualUart::readContinuousHardware(uint8_t buffer[], size_t bufferSize)
+{
+	m_readBuffer = buffer;
+	m_readBufferSize = bufferSize;
+	m_readIndex = 0;
+	m_readContinuous = true;
+	m_readEventPending = false;
+}
+
+void VirtualUart::receive(const uint8_t data[], size_t dataSize)
+{
+	while (dataSize > 0 && m_readBuffer != nullptr)
+	{
+		// Continuous reception stops at the half and the end of the buffer like a circular DMA.
+		size_t end = m_readBufferSize;
+		if (m_readContinuous && m_readIndex < m_readBufferSize / 2)
+			end = m_readBufferSize / 2;
+		size_t count = dataSize < end - m_readIndex ? dataSize : end - m_readIndex;
+		std::memcpy(&m_readBuffer[m_readIndex], data, count);
+		m_readIndex += count;
+		data += count;
+		dataSize -= count;
+
+		if (m_readContinuous)
+		{
+			m_readEventPending = m_readIndex != end;
+			if (m_readIndex == end)
+			{
+				if (m_readIndex == m_readBufferSize)
+					m_readIndex = 0;
+				onDataReceived(end);
+			}
+		}
+		else if (m_readIndex == m_readBufferSize)
+		{
+			// Can start the next read by readHardware().
+			m_readBuffer = nullptr;
+			onDataAvailable();
+		}
+	}
+	m_droppedBytes += dataSize;
+}
+
+void VirtualUart::receiveIdle()
+{
+	if (m_readContinuous && m_readEventPending)
+	{
+		m_readEventPending = false;
+		onDataReceived(m_readIndex);
+	}
+}
+} /* namespace semf */
@@ -0,0 +1,108 @@
+/**
+ * @file virtualuart.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_HARDWAREABSTRACTION_VIRTUAL_VIRTUALUART_H_
+#define SEMF_HARDWAREABSTRACTION_VIRTUAL_VIRTUALUART_H_
+
+#include <semf/communication/uarthardware.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief \c UartHardware implementation without hardware, for testing and benchmarking UART based classes on a host.
+ *
+ * The transmitter of a \c VirtualUart is connected to the receiver of a peer by \c connect(), or to its own receiver
+ * for a loopback. The time is simulated by \c elapse(), which transfers as many bytes as fit into the elapsed time at
+ * the set baud rate and format. Completed transfers call \c onDataWritten() and \c onDataAvailable(), continuous
+ * reception reports half, full and idle-line events like a circular DMA, all within \c elapse().
+ *
+ * Bytes received while no read is active are dropped and counted, see \c droppedBytes().
+ */
+class VirtualUart : public UartHardware
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param baud Baud rate.
+	 */
+	explicit VirtualUart(uint32_t baud = 115200);
+	explicit VirtualUart(const VirtualUart& other) = delete;
+	virtual ~VirtualUart() = default;
+
+	void init() override;
+	void deinit() override;
+	void stopWrite() override;
+	void stopRead() override;
+	void setFormat(uint8_t bits, Parity par, StopBits stop, FlowControl flow) override;
+	void setWireMode(WireMode mode) override;
+	void setDirection(Direction direction) override;
+	void setBaud(uint32_t baud) override;
+	uint32_t baud() override;
+
+	/**
+	 * @brief Connects the transmitter to the receiver of \c peer.
+	 * @param peer Receiving UART, can be \c this for a loopback.
+	 */
+	void connect(VirtualUart& peer);
+	/**
+	 * @brief Simulates the elapsed time and transfers the bytes sent within it.
+	 * If the transmitter runs out of data, an idle line is detected by the peer.
+	 * @param microseconds Elapsed time in microseconds.
+	 */
+	void elapse(uint32_t microseconds);
+	/**
+	 * @brief Returns the number of bytes received while no read was active.
+	 * @return Dropped bytes.
+	 */
+	size_t droppedBytes() const;
+
+protected:
+	void writeHardware(const uint8_t data[], size_t dataSize) override;
+	void readHardware(uint8_t buffer[], size_t bufferSize) override;
+	void readContinuousHardware(uint8_t buffer[], size_t bufferSize) override;
+
+private:
+	/**
+	 * @brief Receives bytes from the transmitting peer.
+	 * @param data Received bytes.
+	 * @param dataSize Number of bytes.
+	 */
+	void receive(const uint8_t data[], size_t dataSize);
+	/**Receives an idle line from the transmitting peer.*/
+	void receiveIdle();
+
+	/**Receiver the transmitter is connected to.*/
+	VirtualUart* m_peer = nullptr;
+	/**Baud rate.*/
+	uint32_t m_baud;
+	/**Length of a frame (start, data, parity and stop bits) in half bits.*/
+	uint32_t m_frameHalfBits = 20;
+	/**Elapsed time not used for a whole byte yet, in microseconds * half bits per second.*/
+	uint64_t m_timeRemainder = 0;
+	/**Data of the active transfer.*/
+	const uint8_t* m_writeData = nullptr;
+	/**Bytes left of the active transfer.*/
+	size_t m_writeRemaining = 0;
+	/**Receive buffer of the active read.*/
+	uint8_t* m_readBuffer = nullptr;
+	/**Size of the receive buffer.*/
+	size_t m_readBufferSize = 0;
+	/**Position in the receive buffer.*/
+	size_t m_readIndex = 0;
+	/**Receive buffer is used circular.*/
+	bool m_readContinuous = false;
+	/**Bytes were received since the last continuous reception event.*/
+	bool m_readEventPending = false;
+	/**Bytes received while no read was active.*/
+	size_t m_droppedBytes = 0;
+};
+} /* namespace semf */
+#endif /* SEMF_HARDWAREABSTRACTION_VIRTUAL_VIRTUALUART_H_ */
@@ -12,6 +12,7 @@
 
 #include <semf/app/input/sensor/sensor.h>
 #include <semf/input/sensor/hardwaresensor.h>
+#include <semf/utils/core/buffer/movingaveragebuffer.h>
 #include <semf/utils/core/signals/slot.h>
 #include <semf/utils/processing/average.h>
 
@@ -31,6 +32,10 @@ template <typename T_RAW, typename T_CONVERTED>
  * 3. Own class inheriting from \c SensorValueConverter and implementing the \c convert() function.
  * 4. \c UserSensor object
  *
+ * By default \c averageValue() sums up the whole raw data buffer of the \c HardwareSensor on every call.
+ * Optionally a \c MovingAverageBuffer can be given in the constructor. The latest raw value is put into it on every
+ * \c dataAvailable of the sensor and \c averageValue() returns its running average without summing up.
+ *
  * * @tparam T_RAW Type of a raw sensor value, e.g. uint16_t for a 16-bit ADC value.
  * * @tparam T_CONVERTED Type of an application/usable sensor value which has an unit, e.g. float for temperature [°C].
  *
@@ -46,6 +51,13 @@ public:
 	 * @param index Index of the specific sensor.
 	 */
 	SensorConverter(HardwareSensor<T_RAW>& hardwareSensor, size_t index);
+	/**
+	 * @brief Constructor for calculating the average value with a running sum.
+	 * @param hardwareSensor Sensor hardware object.
+	 * @param index Index of the specific sensor.
+	 * @param averageBuffer Buffer for the moving average, its size is the number of averaged values.
+	 */
+	SensorConverter(HardwareSensor<T_RAW>& hardwareSensor, size_t index, MovingAverageBuffer<T_RAW>& averageBuffer);
 	explicit SensorConverter(const SensorConverter& other) = delete;
 	virtual ~SensorConverter() = default;
 
@@ -72,6 +84,8 @@ private:
 	HardwareSensor<T_RAW>& m_hardwareSensor;
 	/**Index of the specific sensor.*/
 	size_t m_index;
+	/**Optional buffer for the moving average.*/
+	MovingAverageBuffer<T_RAW>* m_averageBuffer = nullptr;
 	/**Slot for \c HardwareSensor dataAvailable signal.*/
 	SEMF_SLOT(m_onDataAvailableSlot, SensorConverter, *this, onDataAvailable, size_t);
 };
@@ -85,11 +99,25 @@ SensorConverter<T_RAW, T_CONVERTED>::SensorConverter(HardwareSensor<T_RAW>& hard
 	m_hardwareSensor.dataAvailable.connect(m_onDataAvailableSlot);
 }
 
+template <typename T_RAW, typename T_CONVERTED>
+SensorConverter<T_RAW, T_CONVERTED>::SensorConverter(HardwareSensor<T_RAW>& hardwareSensor, size_t index,
+													 MovingAverageBuffer<T_RAW>& averageBuffer)
+: m_hardwareSensor(hardwareSensor),
+  m_index(index),
+  m_averageBuffer(&averageBuffer)
+{
+	m_hardwareSensor.dataAvailable.connect(m_onDataAvailableSlot);
+}
+
 template <typename T_RAW, typename T_CONVERTED>
 void SensorConverter<T_RAW, T_CONVERTED>::onDataAvailable(size_t index)
 {
-	if (index == m_index)
-		app::Sensor<T_CONVERTED>::dataAvailable();
+	if (index != m_index)
+		return;
+
+	if (m_averageBuffer != nullptr)
+		m_averageBuffer->put(m_hardwareSensor.buffer(m_index)[0]);
+	app::Sensor<T_CONVERTED>::dataAvailable();
 }
 
 template <typename T_RAW, typename T_CONVERTED>
@@ -107,6 +135,8 @@ T_CONVERTED SensorConverter<T_RAW, T_CONVERTED>::currentValue() const
 template <typename T_RAW, typename T_CONVERTED>
 T_CONVERTED SensorConverter<T_RAW, T_CONVERTED>::averageValue() const
 {
+	if (m_averageBuffer != nullptr)
+		return convert(m_averageBuffer->average());
 	return convert(Average<T_RAW>::value(m_hardwareSensor.buffer(m_index)));
 }
 } /* namespace semf */
@@ -40,6 +40,14 @@ public:
 	 * @param convertFunction Lambda for converting T_RAW to T_CONVERTED via \c convert() function.
 	 */
 	SimpleSensorConverter(HardwareSensor<T_RAW>& hardwareSensor, size_t index, function convertFunction);
+	/**
+	 * @brief Constructor for calculating the average value with a running sum.
+	 * @param hardwareSensor Sensor hardware object.
+	 * @param index Index of specific sensor.
+	 * @param convertFunction Lambda for converting T_RAW to T_CONVERTED via \c convert() function.
+	 * @param averageBuffer Buffer for the moving average, its size is the number of averaged values.
+	 */
+	SimpleSensorConverter(HardwareSensor<T_RAW>& hardwareSensor, size_t index, function convertFunction, MovingAverageBuffer<T_RAW>& averageBuffer);
 	explicit SimpleSensorConverter(const SimpleSensorConverter& other) = delete;
 	virtual ~SimpleSensorConverter() = default;
 
@@ -58,6 +66,14 @@ SimpleSensorConverter<T_RAW, T_CONVERTED>::SimpleSensorConverter(HardwareSensor<
 {
 }
 
+template <typename T_RAW, typename T_CONVERTED>
+SimpleSensorConverter<T_RAW, T_CONVERTED>::SimpleSensorConverter(HardwareSensor<T_RAW>& hardwareSensor, size_t index, function convertFunction,
+																 MovingAverageBuffer<T_RAW>& averageBuffer)
+: SensorConverter<T_RAW, T_CONVERTED>(hardwareSensor, index, averageBuffer),
+  m_convertFunction(convertFunction)
+{
+}
+
 template <typename T_RAW, typename T_CONVERTED>
 T_CONVERTED SimpleSensorConverter<T_RAW, T_CONVERTED>::convert(T_RAW value) const
 {
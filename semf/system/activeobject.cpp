@@ -0,0 +1,41 @@
+/**
+ * @file activeobject.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/activeobject.h>
+#include <semf/system/scheduler.h>
+
+namespace semf
+{
+ActiveObject::ActiveObject(Scheduler& scheduler, uint8_t priority, MpscQueue<Event>::Entry queue[], size_t queueSize)
+: m_scheduler(scheduler),
+  m_priority(priority),
+  m_queue(queue, queueSize)
+{
+	m_scheduler.add(*this);
+}
+
+ActiveObject::~ActiveObject()
+{
+	m_scheduler.remove(*this);
+}
+
+bool ActiveObject::post(uint32_t id, void* parameter)
+{
+	if (!m_queue.push(Event{id, parameter}))
+		return false;
+
+	m_scheduler.setReady(m_priority);
+	return true;
+}
+
+uint8_t ActiveObject::priority() const
+{
+	return m_priority;
+}
+} /* namespace semf */
@@ -0,0 +1,92 @@
+/**
+ * @file activeobject.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_SYSTEM_ACTIVEOBJECT_H_
+#define SEMF_SYSTEM_ACTIVEOBJECT_H_
+
+#include <semf/utils/core/queues/linkedqueue.h>
+#include <semf/utils/core/queues/mpscqueue.h>
+#include <cstdint>
+
+namespace semf
+{
+class Scheduler;
+/**
+ * @brief An \c ActiveObject owns an event queue and handles its events one after another in the context of a \c Scheduler.
+ *
+ * To use this base class, inherit from it and override the \c handle() function.
+ * Events are posted by \c post(), which can be called from any context including interrupt service routines.
+ * Each event is handled to completion before the \c Scheduler dispatches the next one.
+ * The destructor removes the object from the \c Scheduler again.
+ *
+ * @see \c Scheduler
+ */
+class ActiveObject : public LinkedQueue<ActiveObject>::Node
+{
+public:
+	/**
+	 * @brief Event posted to an \c ActiveObject.
+	 */
+	struct Event
+	{
+		/**User defined identifier of the event.*/
+		uint32_t id;
+		/**Optional user defined parameter.*/
+		void* parameter;
+	};
+
+	/**
+	 * @brief Constructor, registers the object at the scheduler.
+	 * @param scheduler Scheduler to run the object in.
+	 * @param priority Priority of the object, higher values are dispatched first. Must be less than \c Scheduler::kMaxPriorities.
+	 * @param queue Array of entries for the event queue. It is used by the constructor already,
+	 *        so it must not be a member of the derived class.
+	 * @param queueSize Number of entries in the array, at least two.
+	 */
+	ActiveObject(Scheduler& scheduler, uint8_t priority, MpscQueue<Event>::Entry queue[], size_t queueSize);
+	explicit ActiveObject(const ActiveObject& other) = delete;
+	/**
+	 * @brief Destructor, removes the object from the scheduler.
+	 * @attention Must not be called while the scheduler is dispatching in another context.
+	 */
+	virtual ~ActiveObject();
+
+	/**
+	 * @brief Posts an event into the queue of this object.
+	 * @note Can be called from any context.
+	 * @param id Identifier of the event.
+	 * @param parameter Optional parameter.
+	 * @return \c true for posted, \c false if the event queue is full.
+	 */
+	bool post(uint32_t id, void* parameter = nullptr);
+	/**
+	 * @brief Returns the priority of this object.
+	 * @return Priority.
+	 */
+	uint8_t priority() const;
+
+protected:
+	/**
+	 * @brief Handles one event. Is called by the \c Scheduler.
+	 * @param event Event to handle.
+	 */
+	virtual void handle(const Event& event) = 0;
+
+private:
+	/**Scheduler the object runs in.*/
+	Scheduler& m_scheduler;
+	/**Priority of the object.*/
+	uint8_t m_priority;
+	/**Event queue.*/
+	MpscQueue<Event> m_queue;
+	/**Scheduler is friend for accessing the event queue.*/
+	friend class Scheduler;
+};
+} /* namespace semf */
+#endif /* SEMF_SYSTEM_ACTIVEOBJECT_H_ */
@@ -0,0 +1,153 @@
+/**
+ * @file deadlinescheduler.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/criticalsection.h>
+#include <semf/system/deadlinescheduler.h>
+#include <semf/utils/core/debug.h>
+#include <semf/utils/system/deadlinetimer.h>
+
+namespace semf
+{
+DeadlineScheduler::DeadlineScheduler(app::AlarmTimer& timer, bool enable)
+: m_timer(timer)
+{
+	timer.timeout.connect(m_onAlarmSlot);
+	if (enable)
+		this->enable();
+}
+
+void DeadlineScheduler::enable()
+{
+	m_timer.start();
+	CriticalSection::enter();
+	if (!m_handling)
+		armAlarm();
+	CriticalSection::exit();
+}
+
+void DeadlineScheduler::disable()
+{
+	m_timer.stop();
+	m_timer.clearAlarm();
+}
+
+uint32_t DeadlineScheduler::now() const
+{
+	return m_timer.now();
+}
+
+uint32_t DeadlineScheduler::timeUntilNextEvent() const
+{
+	CriticalSection::enter();
+	uint32_t ticks = kNoEvent;
+	if (m_first != nullptr)
+	{
+		int32_t difference = static_cast<int32_t>(m_first->m_expiry - m_timer.now());
+		ticks = difference > 0 ? static_cast<uint32_t>(difference) : 0;
+	}
+	CriticalSection::exit();
+	return ticks;
+}
+
+void DeadlineScheduler::schedule(DeadlineTimer& timer, uint32_t ticks)
+{
+	if (ticks == 0)
+		ticks = 1;
+
+	timer.m_expiry = m_timer.now() + ticks;
+	insert(timer);
+	if (!m_handling)
+		armAlarm();
+}
+
+void DeadlineScheduler::unschedule(DeadlineTimer& timer)
+{
+	DeadlineTimer** link = &m_first;
+	while (*link != nullptr && *link != &timer)
+		link = &(*link)->m_next;
+	if (*link == nullptr)
+		return;
+
+	bool first = link == &m_first;
+	*link = timer.m_next;
+	timer.m_next = nullptr;
+	if (first && !m_handling)
+		armAlarm();
+}
+
+void DeadlineScheduler::insert(DeadlineTimer& timer)
+{
+	// Timers with the same expiry keep their scheduling order.
+	DeadlineTimer** link = &m_first;
+	while (*link != nullptr && static_cast<int32_t>((*link)->m_expiry - timer.m_expiry) <= 0)
+		link = &(*link)->m_next;
+	timer.m_next = *link;
+	*link = &timer;
+}
+
+void DeadlineScheduler::onAlarm()
+{
+	CriticalSection::enter();
+	if (m_handling)
+	{
+		CriticalSection::exit();
+		return;
+	}
+	m_handling = true;
+
+	// Only timers expired before the alarm is handled are emitted. Compared against the running counter, long
+	// timeout slots or short intervals could keep this loop busy forever, later expiries get the next alarm instead.
+	uint32_t now = m_timer.now();
+	while (m_first != nullptr && static_cast<int32_t>(m_first->m_expiry - now) <= 0)
+	{
+		DeadlineTimer& timer = *m_first;
+		m_first = timer.m_next;
+		timer.m_next = nullptr;
+
+		// Periodic timers are rescheduled from their last expiry to avoid drift, but never into the past.
+		uint32_t interval = timer.interval() > 0 ? timer.interval() : 1;
+		uint32_t expiry = timer.m_expiry + interval;
+		if (static_cast<int32_t>(expiry - m_timer.now()) <= 0)
+			expiry = m_timer.now() + interval;
+		timer.m_expiry = expiry;
+		insert(timer);
+
+		SEMF_INFO("timeout");
+		CriticalSection::exit();
+		timer.timeout();
+		CriticalSection::enter();
+	}
+	armAlarm();
+
+	m_handling = false;
+	CriticalSection::exit();
+}
+
+void DeadlineScheduler::armAlarm()
+{
+	if (m_first == nullptr)
+	{
+		m_timer.clearAlarm();
+		return;
+	}
+
+	uint32_t alarm = m_first->m_expiry;
+	uint32_t lead = 1;
+	while (true)
+	{
+		m_timer.setAlarm(alarm);
+		if (static_cast<int32_t>(alarm - m_timer.now()) > 0)
+			return;
+		// The counter passed the alarm tick while setting it. The timeout is not emitted here, because the caller
+		// may hold a critical section, instead the alarm is set shortly into the future, increasing the lead time.
+		alarm = m_timer.now() + lead;
+		lead <<= 1;
+	}
+}
+} /* namespace semf */
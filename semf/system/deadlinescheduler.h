@@ -0,0 +1,109 @@
+/**
+ * @file deadlinescheduler.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_SYSTEM_DEADLINESCHEDULER_H_
+#define SEMF_SYSTEM_DEADLINESCHEDULER_H_
+
+#include <semf/app/system/alarmtimer.h>
+#include <semf/utils/core/signals/slot.h>
+#include <cstdint>
+
+namespace semf
+{
+class DeadlineTimer;
+/**
+ * @brief \c DeadlineScheduler runs \c DeadlineTimer objects without a periodic tick.
+ *
+ * The timers are kept in a list sorted by their expiry tick and only the alarm of the hardware timer is set to the
+ * earliest expiry. On the alarm all expired timers emit their \c timeout and the alarm is set to the next expiry,
+ * so there is no interrupt as long as no timer is due.
+ *
+ * \c timeUntilNextEvent() returns the ticks to the next expiry, which can be used by an idle hook to decide whether
+ * to enter a sleep mode. The alarm interrupt wakes up the microcontroller in time:
+ * @code
+ * while (true)
+ * {
+ *     if (scheduler.timeUntilNextEvent() > kMinimumSleepTicks)
+ *         power.sleep();
+ * }
+ * @endcode
+ *
+ * @note For using \c DeadlineTimer a global \c CriticalSection object is required.
+ * @note Intervals have to be smaller than half of the counter range, because expiry ticks are compared with wrap
+ *       around.
+ */
+class DeadlineScheduler
+{
+public:
+	/**Is returned by \c timeUntilNextEvent() if no timer is running.*/
+	static constexpr uint32_t kNoEvent = UINT32_MAX;
+
+	/**
+	 * @brief Constructor.
+	 * @param timer Free running hardware timer with compare unit.
+	 * @param enable Starts the hardware timer.
+	 */
+	explicit DeadlineScheduler(app::AlarmTimer& timer, bool enable = false);
+	explicit DeadlineScheduler(const DeadlineScheduler& other) = delete;
+	virtual ~DeadlineScheduler() = default;
+
+	/**Starts the hardware timer.*/
+	void enable();
+	/**Stops the hardware timer.*/
+	void disable();
+	/**
+	 * @brief Returns the actual tick of the hardware timer.
+	 * @return Counter value.
+	 */
+	uint32_t now() const;
+	/**
+	 * @brief Returns the number of ticks until the next timer expires.
+	 * @return Ticks to the next expiry, zero if a timer is already due, \c kNoEvent if no timer is running.
+	 */
+	uint32_t timeUntilNextEvent() const;
+
+private:
+	/**
+	 * @brief Sorts a timer into the list by its expiry tick and updates the alarm.
+	 * @param timer Timer to add.
+	 * @param ticks Number of ticks until the timer expires, zero is handled like one.
+	 */
+	void schedule(DeadlineTimer& timer, uint32_t ticks);
+	/**
+	 * @brief Removes a timer from the list and updates the alarm.
+	 * @param timer Timer to remove.
+	 */
+	void unschedule(DeadlineTimer& timer);
+	/**
+	 * @brief Sorts a timer into the list without touching the alarm.
+	 * @param timer Timer to add.
+	 */
+	void insert(DeadlineTimer& timer);
+	/**Emits the timeout of all timers expired when the alarm is handled and sets the alarm to the next expiry.*/
+	void onAlarm();
+	/**
+	 * @brief Sets the alarm to the expiry of the first timer, or clears it if no timer is running.
+	 * @note An already expired timer gets an alarm shortly in the future, so its \c timeout is always emitted by
+	 *       \c onAlarm() in the alarm interrupt and never in the context calling \c DeadlineTimer::start().
+	 */
+	void armAlarm();
+
+	/**Hardware timer.*/
+	app::AlarmTimer& m_timer;
+	/**First timer of the list sorted by expiry tick.*/
+	DeadlineTimer* m_first = nullptr;
+	/**On true, expired timers are handled in \c onAlarm() and the alarm is set at its end.*/
+	bool m_handling = false;
+	/**Slot for alarm function.*/
+	SEMF_SLOT(m_onAlarmSlot, DeadlineScheduler, *this, onAlarm);
+	/**DeadlineTimer is friend for scheduling itself.*/
+	friend class DeadlineTimer;
+};
+} /* namespace semf */
+#endif /* SEMF_SYSTEM_DEADLINESCHEDULER_H_ */
@@ -0,0 +1,80 @@
+/**
+ * @file eventloop.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/eventloop.h>
+#include <semf/utils/core/debug.h>
+
+namespace semf
+{
+EventLoop::EventLoop(Entry queue[], size_t queueSize)
+: m_queue(queue, queueSize)
+{
+}
+
+size_t EventLoop::process()
+{
+	size_t dispatched = 0;
+	Posted* posted;
+	while ((posted = m_queue.front()) != nullptr)
+	{
+		if (m_timestamp != nullptr)
+		{
+			uint32_t latency = m_timestamp() - posted->timestamp;
+			if (latency > m_maxLatency)
+				m_maxLatency = latency;
+			m_latencySum += latency;
+		}
+		m_dispatched++;
+
+		SEMF_INFO("dispatch event %p", posted->event);
+		posted->event->dispatch(posted->arguments);
+		m_queue.release();
+		dispatched++;
+	}
+	return dispatched;
+}
+
+bool EventLoop::isEmpty() const
+{
+	return m_queue.empty();
+}
+
+void EventLoop::setTimestampFunction(TimestampFunction timestamp)
+{
+	m_timestamp = timestamp;
+}
+
+uint32_t EventLoop::maxLatency() const
+{
+	return m_maxLatency;
+}
+
+uint32_t EventLoop::averageLatency() const
+{
+	return m_dispatched > 0 ? static_cast<uint32_t>(m_latencySum / m_dispatched) : 0;
+}
+
+uint32_t EventLoop::dispatchedCount() const
+{
+	return m_dispatched;
+}
+
+uint32_t EventLoop::droppedCount() const
+{
+	return m_dropped.load(std::memory_order_relaxed);
+}
+
+void EventLoop::resetStatistics()
+{
+	m_maxLatency = 0;
+	m_latencySum = 0;
+	m_dispatched = 0;
+	m_dropped.store(0, std::memory_order_relaxed);
+}
+} /* namespace semf */
@@ -0,0 +1,181 @@
+/**
+ * @file eventloop.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_SYSTEM_EVENTLOOP_H_
+#define SEMF_SYSTEM_EVENTLOOP_H_
+
+#include <semf/utils/core/queues/mpscqueue.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+
+/**Size in bytes of the packed arguments stored with each queued event.*/
+#ifndef SEMF_EVENTLOOP_ARGUMENTS_SIZE
+#define SEMF_EVENTLOOP_ARGUMENTS_SIZE 16
+#endif
+
+namespace semf
+{
+/**
+ * @brief \c EventLoop moves work from interrupt service routines into the main loop.
+ *
+ * Events (e.g. a \c DeferredSignal together with its packed arguments) are posted into a fixed-capacity lock-free
+ * \c MpscQueue, which can be done from any interrupt priority. The arguments are packed into the queue entry in place. The function \c process() has to be called cyclically from
+ * the main loop and dispatches all queued events in the order they were posted.
+ *
+ * If a timestamp function is set by \c setTimestampFunction(), the time every event spent in the queue is measured.
+ * The statistics can be read by \c maxLatency() and \c averageLatency().
+ *
+ * @note The queue capacity is the biggest power of two not bigger than the size of the given array.
+ *       The array needs at least two entries, with a smaller array every \c post() fails.
+ * @note On cores without exclusive access instructions (e.g. Cortex-M0) \c std::atomic may fall back to a locking
+ *       implementation of the toolchain.
+ */
+class EventLoop
+{
+public:
+	/**
+	 * @brief Base class for everything which can be posted into an \c EventLoop.
+	 */
+	class Event
+	{
+	public:
+		Event() = default;
+		explicit Event(const Event& other) = delete;
+		virtual ~Event() = default;
+
+	protected:
+		/**
+		 * @brief Is called by \c EventLoop::process() in the main loop context.
+		 * @param arguments Pointer to the packed arguments stored by \c EventLoop::post().
+		 *        The implementation has to destroy the arguments object.
+		 */
+		virtual void dispatch(void* arguments) = 0;
+
+	private:
+		/**EventLoop is friend for calling dispatch.*/
+		friend class EventLoop;
+	};
+
+	/**
+	 * @brief Posted event together with its packed arguments.
+	 */
+	struct Posted
+	{
+		/**Posted event.*/
+		Event* event = nullptr;
+		/**Timestamp when the event was posted.*/
+		uint32_t timestamp = 0;
+		/**Storage for the packed arguments.*/
+		alignas(std::max_align_t) uint8_t arguments[SEMF_EVENTLOOP_ARGUMENTS_SIZE];
+	};
+	/**Queue entry for one posted event.*/
+	typedef MpscQueue<Posted>::Entry Entry;
+
+	/**Function type for reading a free-running timestamp, e.g. a hardware timer counter.*/
+	typedef uint32_t (*TimestampFunction)();
+
+	/**
+	 * @brief Constructor.
+	 * @param queue Array of entries for storing posted events.
+	 * @param queueSize Number of entries in the array, at least two.
+	 */
+	EventLoop(Entry queue[], size_t queueSize);
+	explicit EventLoop(const EventLoop& other) = delete;
+	virtual ~EventLoop() = default;
+
+	/**
+	 * @brief Posts an event with packed arguments into the queue.
+	 * @note Can be called from any interrupt service routine.
+	 * @tparam Arguments Types of the arguments.
+	 * @param event Event to dispatch.
+	 * @param arguments Arguments to pass to \c Event::dispatch() packed in a \c std::tuple.
+	 * @return \c true for posted, \c false if the queue is full.
+	 */
+	template <typename... Arguments>
+	bool post(Event& event, Arguments... arguments);
+	/**
+	 * @brief Dispatches all queued events in the order they were posted.
+	 * @attention Must be called cyclically from the main loop.
+	 * @return Number of dispatched events.
+	 */
+	size_t process();
+	/**
+	 * @brief Returns if no event is queued.
+	 * @return \c true for no event queued, otherwise \c false.
+	 */
+	bool isEmpty() const;
+	/**
+	 * @brief Sets the function for reading the timestamps used for latency measurement.
+	 * @param timestamp Function returning a free-running counter value, \c nullptr disables the measurement.
+	 */
+	void setTimestampFunction(TimestampFunction timestamp);
+	/**
+	 * @brief Returns the longest time an event spent in the queue.
+	 * @return Latency in ticks of the timestamp function.
+	 */
+	uint32_t maxLatency() const;
+	/**
+	 * @brief Returns the average time an event spent in the queue.
+	 * @return Latency in ticks of the timestamp function.
+	 */
+	uint32_t averageLatency() const;
+	/**
+	 * @brief Returns the number of events dispatched since the last \c resetStatistics().
+	 * @return Number of events.
+	 */
+	uint32_t dispatchedCount() const;
+	/**
+	 * @brief Returns the number of events not posted because the queue was full since the last \c resetStatistics().
+	 * @return Number of events.
+	 */
+	uint32_t droppedCount() const;
+	/**Resets the latency and event counters.*/
+	void resetStatistics();
+
+private:
+	/**Queue of posted events.*/
+	MpscQueue<Posted> m_queue;
+	/**Function for reading timestamps.*/
+	TimestampFunction m_timestamp = nullptr;
+	/**Maximum latency.*/
+	uint32_t m_maxLatency = 0;
+	/**Sum of all latencies.*/
+	uint64_t m_latencySum = 0;
+	/**Number of dispatched events.*/
+	uint32_t m_dispatched = 0;
+	/**Number of dropped events.*/
+	std::atomic<uint32_t> m_dropped{0};
+};
+
+template <typename... Arguments>
+bool EventLoop::post(Event& event, Arguments... arguments)
+{
+	static_assert(sizeof(std::tuple<Arguments...>) <= SEMF_EVENTLOOP_ARGUMENTS_SIZE, "Increase SEMF_EVENTLOOP_ARGUMENTS_SIZE");
+	static_assert(alignof(std::tuple<Arguments...>) <= alignof(std::max_align_t), "Over-aligned arguments are not supported");
+
+	size_t pos;
+	Posted* posted = m_queue.claim(pos);
+	if (posted == nullptr)
+	{
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	posted->event = &event;
+	new (posted->arguments) std::tuple<Arguments...>(arguments...);
+	if (m_timestamp != nullptr)
+		posted->timestamp = m_timestamp();
+	m_queue.publish(pos);
+	return true;
+}
+} /* namespace semf */
+#endif /* SEMF_SYSTEM_EVENTLOOP_H_ */
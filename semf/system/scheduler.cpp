@@ -0,0 +1,126 @@
+/**
+ * @file scheduler.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/scheduler.h>
+#include <semf/utils/core/debug.h>
+
+namespace semf
+{
+void Scheduler::add(ActiveObject& activeObject)
+{
+	if (activeObject.priority() >= kMaxPriorities)
+	{
+		SEMF_ERROR("priority %u out of range", activeObject.priority());
+		return;
+	}
+	m_queues[activeObject.priority()].push(activeObject);
+	if (!activeObject.m_queue.empty())
+		setReady(activeObject.priority());
+}
+
+void Scheduler::remove(ActiveObject& activeObject)
+{
+	if (activeObject.priority() >= kMaxPriorities)
+		return;
+
+	// LinkedQueue only removes from the front, so rotate once through the queue and leave the object out.
+	LinkedQueue<ActiveObject>& queue = m_queues[activeObject.priority()];
+	for (size_t i = queue.size(); i > 0; i--)
+	{
+		ActiveObject& front = queue.front();
+		queue.pop();
+		if (&front != &activeObject)
+			queue.push(front);
+	}
+}
+
+void Scheduler::setReady(uint8_t priority)
+{
+	if (priority >= kMaxPriorities)
+		return;
+	m_ready.fetch_or(1UL << priority, std::memory_order_release);
+}
+
+bool Scheduler::dispatch()
+{
+	uint32_t ready = m_ready.load(std::memory_order_acquire);
+	if (ready == 0)
+		return false;
+
+	uint8_t priority = highestPriority(ready);
+	uint32_t mask = 1UL << priority;
+	// Clear before checking the queues, so a concurrent post sets the flag again.
+	m_ready.fetch_and(~mask, std::memory_order_acq_rel);
+
+	LinkedQueue<ActiveObject>& queue = m_queues[priority];
+	bool dispatched = false;
+	for (size_t i = 0; i < queue.size() && !dispatched; i++)
+	{
+		// Rotate the queue for round robin between objects of the same priority.
+		ActiveObject& activeObject = queue.front();
+		queue.pop();
+		queue.push(activeObject);
+
+		ActiveObject::Event event;
+		if (activeObject.m_queue.pop(event))
+		{
+			SEMF_INFO("dispatch event %u, priority %u", event.id, priority);
+			activeObject.handle(event);
+			dispatched = true;
+		}
+	}
+
+	for (auto& activeObject : queue)
+	{
+		if (!activeObject.m_queue.empty())
+		{
+			setReady(priority);
+			break;
+		}
+	}
+	return dispatched;
+}
+
+size_t Scheduler::process()
+{
+	size_t dispatched = 0;
+	while (isReady())
+	{
+		if (dispatch())
+			dispatched++;
+	}
+	return dispatched;
+}
+
+void Scheduler::run()
+{
+	while (true)
+	{
+		if (!dispatch() && !isReady())
+			idle();
+	}
+}
+
+bool Scheduler::isReady() const
+{
+	return m_ready.load(std::memory_order_acquire) != 0;
+}
+
+uint8_t Scheduler::highestPriority(uint32_t ready)
+{
+#if defined(__GNUC__)
+	return static_cast<uint8_t>(31 - __builtin_clz(ready));
+#else
+	uint8_t priority = kMaxPriorities - 1;
+	while (!(ready & (1UL << priority)))
+		priority--;
+	return priority;
+#endif
+}
+} /* namespace semf */
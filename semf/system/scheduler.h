@@ -0,0 +1,105 @@
+/**
+ * @file scheduler.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_SYSTEM_SCHEDULER_H_
+#define SEMF_SYSTEM_SCHEDULER_H_
+
+#include <semf/system/activeobject.h>
+#include <semf/utils/core/queues/linkedqueue.h>
+#include <semf/utils/core/signals/signal.h>
+#include <atomic>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Priority based run-to-completion scheduler for \c ActiveObject.
+ *
+ * Every \c ActiveObject is put into the queue of its priority when it is constructed.
+ * Posting an event marks the priority of the receiving object as ready in an atomic bit mask,
+ * so \c ActiveObject::post() can be called from interrupt service routines without locking.
+ *
+ * \c dispatch() handles one event of the highest ready priority. Objects of the same priority
+ * are served round robin. Because every event is handled to completion, no stack per object is needed.
+ *
+ * If no event is ready, \c run() emits the \c idle signal, e.g. for connecting a \c Power::sleep() call.
+ *
+ * @attention \c dispatch(), \c process() and \c run() must only be called from one context, normally the main loop.
+ *
+ * @see \c ActiveObject
+ */
+class Scheduler
+{
+public:
+	/**Number of supported priorities.*/
+	static constexpr uint8_t kMaxPriorities = 32;
+
+	Scheduler() = default;
+	explicit Scheduler(const Scheduler& other) = delete;
+	virtual ~Scheduler() = default;
+
+	/**
+	 * @brief Adds an active object to the queue of its priority.
+	 * @note Is called by the constructor of \c ActiveObject.
+	 * @attention Must not be called while the scheduler is running in another context.
+	 * @param activeObject Active object to add.
+	 */
+	void add(ActiveObject& activeObject);
+	/**
+	 * @brief Removes an active object from the queue of its priority, pending events of it are dropped.
+	 * @note Is called by the destructor of \c ActiveObject.
+	 * @attention Must not be called while the scheduler is running in another context.
+	 * @param activeObject Active object to remove.
+	 */
+	void remove(ActiveObject& activeObject);
+	/**
+	 * @brief Marks a priority as ready.
+	 * @note Is called by \c ActiveObject::post() and can be called from any context.
+	 * @param priority Priority having at least one pending event.
+	 */
+	void setReady(uint8_t priority);
+	/**
+	 * @brief Handles one event of the highest ready priority.
+	 * @return \c true if an event was handled, \c false if no event is pending.
+	 */
+	bool dispatch();
+	/**
+	 * @brief Handles events until no event is pending.
+	 * @return Number of handled events.
+	 */
+	size_t process();
+	/**
+	 * @brief Handles events forever and emits the \c idle signal if no event is pending.
+	 * @attention This function does not return.
+	 */
+	[[noreturn]] void run();
+	/**
+	 * @brief Returns if any event is pending.
+	 * @return \c true for pending events, otherwise \c false.
+	 */
+	bool isReady() const;
+
+	/**Signal is emitted by \c run() if no event is pending.*/
+	Signal<> idle;
+
+private:
+	/**
+	 * @brief Returns the highest priority set in a ready mask.
+	 * @param ready Ready mask, must not be zero.
+	 * @return Priority.
+	 */
+	static uint8_t highestPriority(uint32_t ready);
+
+	/**Bit mask of priorities with pending events.*/
+	std::atomic<uint32_t> m_ready{0};
+	/**Active objects sorted by priority.*/
+	LinkedQueue<ActiveObject> m_queues[kMaxPriorities];
+};
+} /* namespace semf */
+#endif /* SEMF_SYSTEM_SCHEDULER_H_ */
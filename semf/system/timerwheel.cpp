@@ -0,0 +1,86 @@
+/**
+ * @file timerwheel.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/timerwheel.h>
+#include <semf/utils/core/debug.h>
+#include <semf/utils/system/wheeltimer.h>
+
+namespace semf
+{
+TimerWheel::TimerWheel(app::Timer& timer, LinkedList<WheelTimer> slots[], size_t slotCount, bool enable)
+: TimeBase(timer, enable),
+  m_slots(slots)
+{
+	uint32_t count = 1;
+	while (count <= slotCount / 2)
+		count <<= 1;
+	m_mask = count - 1;
+
+	timer.timeout.connect(m_advanceSlot);
+}
+
+uint32_t TimerWheel::now() const
+{
+	return m_now;
+}
+
+void TimerWheel::schedule(WheelTimer& timer, uint32_t ticks)
+{
+	if (ticks == 0)
+		ticks = 1;
+
+	timer.m_expiry = m_now + ticks;
+	LinkedList<WheelTimer>& slot = m_slots[timer.m_expiry & m_mask];
+	slot.pushBack(timer);
+	timer.m_list = &slot;
+}
+
+void TimerWheel::unschedule(WheelTimer& timer)
+{
+	if (timer.m_list == nullptr)
+		return;
+
+	timer.m_list->erase(LinkedList<WheelTimer>::Iterator(&timer));
+	timer.m_list = nullptr;
+}
+
+void TimerWheel::advance()
+{
+	if (!isEnabled())
+		return;
+
+	m_now++;
+	LinkedList<WheelTimer>& slot = m_slots[m_now & m_mask];
+	for (auto it = slot.begin(); it != slot.end();)
+	{
+		if (it->m_expiry == m_now)
+		{
+			WheelTimer& timer = *it;
+			it = slot.erase(it);
+			m_due.pushBack(timer);
+			timer.m_list = &m_due;
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	// Timers are rescheduled before emitting, so a slot can stop or restart any of the due timers.
+	while (!m_due.empty())
+	{
+		WheelTimer& timer = m_due.front();
+		m_due.popFront();
+		timer.m_list = nullptr;
+		schedule(timer, timer.interval());
+		SEMF_INFO("timeout");
+		timer.timeout();
+	}
+}
+} /* namespace semf */
@@ -0,0 +1,88 @@
+/**
+ * @file timerwheel.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_SYSTEM_TIMERWHEEL_H_
+#define SEMF_SYSTEM_TIMERWHEEL_H_
+
+#include <semf/system/timebase.h>
+#include <semf/utils/core/lists/linkedlist.h>
+#include <semf/utils/core/signals/slot.h>
+#include <cstdint>
+
+namespace semf
+{
+class WheelTimer;
+/**
+ * @brief \c TimerWheel is a \c TimeBase, which sorts its \c WheelTimer objects into slots by their expiry tick.
+ *
+ * On every tick only the slot of the current tick is checked, so the timers which are not due are not touched.
+ * Timers with an interval longer than the number of slots share a slot with earlier timers and are skipped
+ * until their round is reached, so the number of slots should be bigger than the usual timer intervals.
+ *
+ * Because \c TimerWheel is a \c TimeBase, \c TickReceiver objects like \c DigitalInPolling can still be added and
+ * are called on every tick.
+ *
+ * @note For using \c WheelTimer a global \c CriticalSection object is required.
+ * @note The number of slots is the biggest power of two not bigger than the size of the given array.
+ */
+class TimerWheel : public TimeBase
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param timer Timer interface (e.g. hardware timer).
+	 * @param slots Array of lists for sorting the timers in.
+	 * @param slotCount Number of lists in the array.
+	 * @param enable Enables the \c TimerWheel.
+	 */
+	TimerWheel(app::Timer& timer, LinkedList<WheelTimer> slots[], size_t slotCount, bool enable = false);
+	explicit TimerWheel(const TimerWheel& other) = delete;
+	//! @cond Doxygen_Suppress
+	virtual ~TimerWheel() = default;
+	//! @endcond
+
+	/**
+	 * @brief Returns the number of ticks counted since construction.
+	 * @return Tick counter.
+	 */
+	uint32_t now() const;
+
+private:
+	/**
+	 * @brief Sorts a timer into the slot of its expiry tick.
+	 * @param timer Timer to add.
+	 * @param ticks Number of ticks until the timer expires, zero is handled like one.
+	 */
+	void schedule(WheelTimer& timer, uint32_t ticks);
+	/**
+	 * @brief Removes a timer from its slot.
+	 * @param timer Timer to remove.
+	 */
+	void unschedule(WheelTimer& timer);
+	/**
+	 * @brief Counts the tick and emits the timeout of all due timers.
+	 * @attention Must be called cyclically by a timer interrupt or similar.
+	 */
+	void advance();
+
+	/**Slots for sorting timers by their expiry tick.*/
+	LinkedList<WheelTimer>* m_slots;
+	/**Mask for calculating the slot from a tick.*/
+	uint32_t m_mask = 0;
+	/**Timers expired in the current tick.*/
+	LinkedList<WheelTimer> m_due;
+	/**Tick counter.*/
+	uint32_t m_now = 0;
+	/**Slot for advance function.*/
+	SEMF_SLOT(m_advanceSlot, TimerWheel, *this, advance);
+	/**WheelTimer is friend for scheduling itself.*/
+	friend class WheelTimer;
+};
+} /* namespace semf */
+#endif /* SEMF_SYSTEM_TIMERWHEEL_H_ */
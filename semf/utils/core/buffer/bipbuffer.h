@@ -0,0 +1,279 @@
+/**
+ * @file bipbuffer.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_CORE_BUFFER_BIPBUFFER_H_
+#define SEMF_UTILS_CORE_BUFFER_BIPBUFFER_H_
+
+#include <semf/utils/core/buffer/buffer.h>
+#include <algorithm>
+
+namespace semf
+{
+/**
+ * @brief The \c BipBuffer class implements a bi-partite circular buffer, which hands out contiguous memory regions.
+ *
+ * Compared to \c RingBuffer, data is not copied into or out of the buffer entry by entry.
+ * Instead the writer reserves a contiguous region by \c reserveWrite(), fills it directly (e.g. by DMA or
+ * \c UartHardware::read()) and publishes the written entries by \c commitWrite().
+ * The reader gets the oldest contiguous block of committed data by \c peekRead() and frees it by \c release().
+ *
+ * Internally the data array is split into two regions: region A is the one being read from, region B starts at the
+ * beginning of the array and is only used as soon as there is not enough space behind region A.
+ * This way every reserved and every read region is contiguous, at the cost of unused space at the end of the array.
+ *
+ * The data base is an array with the data type defined by the template parameter \c T.
+ * To use the \c BipBuffer set the array in the constructor or by the function \c setBuffer().
+ *
+ * See also \c Buffer, \c RingBuffer, \c LastInBuffer and \c LastInDmaBuffer.
+ *
+ * @note For using \c BipBuffer a global \c CriticalSection object is required.
+ * @note One writer and one reader can use the buffer concurrently, only one reservation can be active at a time.
+ *
+ * @tparam T Type of data to handle.
+ */
+template <typename T>
+class BipBuffer : public Buffer<T>
+{
+public:
+	using Buffer<T>::Buffer;
+
+	/**
+	 * @brief Reserves a contiguous region for writing.
+	 * @note A new reservation replaces a not committed one.
+	 * @param size Number of entries to reserve.
+	 * @return Pointer to the reserved region, \c nullptr if there is no contiguous free space with the requested size.
+	 */
+	T* reserveWrite(size_t size);
+	/**
+	 * @brief Returns the size of the biggest contiguous region \c reserveWrite() can currently provide.
+	 * @return Number of entries.
+	 */
+	size_t maxReserveSize() const;
+	/**
+	 * @brief Publishes entries written into the region returned by \c reserveWrite() for reading and ends the reservation.
+	 * @param size Number of entries written, limited to the reserved size. Zero cancels the reservation.
+	 */
+	void commitWrite(size_t size);
+	/**
+	 * @brief Returns the oldest contiguous block of committed data without removing it.
+	 * @param size Returns the number of entries in the block.
+	 * @return Pointer to the block, \c nullptr if the buffer is empty.
+	 */
+	T* peekRead(size_t& size);
+	/**
+	 * @brief Removes entries from the block returned by \c peekRead().
+	 * @param size Number of entries to remove, limited to the size of the block.
+	 */
+	void release(size_t size);
+	/**
+	 * @brief Returns the entry from a specific position in the committed data.
+	 * @param pos Position in the buffer, \c 0 is the oldest entry not read yet.
+	 * @return Entry.
+	 * @note Using this function while \c USE_SEMF_DEBUG or \c DEBUG being defined will cause a boundary check. In case of failing the boundary check the
+	 *       function will dereference a \c nullptr in order to crash the software forcefully.
+	 */
+	T& operator[](size_t pos) const override;
+	/**
+	 * @brief Returns the number of committed entries not read yet.
+	 * @return Number of entries.
+	 */
+	size_t count() const override;
+	/**
+	 * @brief Returns if the buffer is empty.
+	 * @return \li true: No unread data available.
+	 * 		   \li false: Unread data available.
+	 */
+	bool isEmpty() const;
+	/**
+	 * @brief Clears the buffer and cancels the reservation.
+	 * @note The data in the base array will not be modified.
+	 */
+	void reset();
+
+private:
+	/**Start position of region A*/
+	size_t m_aStart = 0;
+	/**End position (exclusive) of region A*/
+	size_t m_aEnd = 0;
+	/**End position (exclusive) of region B, region B always starts at zero*/
+	size_t m_bEnd = 0;
+	/**Flag for region B is in use*/
+	bool m_bInUse = false;
+	/**Start position of the current reservation*/
+	size_t m_reserveStart = 0;
+	/**Size of the current reservation*/
+	size_t m_reserveSize = 0;
+};
+
+template <typename T>
+T* BipBuffer<T>::reserveWrite(size_t size)
+{
+	if (size == 0)
+	{
+		return nullptr;
+	}
+
+	CriticalSection::enter();
+	m_reserveSize = 0;
+	if (!m_bInUse && m_aStart == m_aEnd)
+	{
+		m_aStart = 0;
+		m_aEnd = 0;
+	}
+
+	if (m_bInUse)
+	{
+		if (m_aStart - m_bEnd >= size)
+		{
+			m_reserveStart = m_bEnd;
+			m_reserveSize = size;
+		}
+	}
+	else if (this->size() - m_aEnd >= size)
+	{
+		m_reserveStart = m_aEnd;
+		m_reserveSize = size;
+	}
+	else if (m_aStart >= size)
+	{
+		m_reserveStart = 0;
+		m_reserveSize = size;
+	}
+	size_t reserveStart = m_reserveStart;
+	size_t reserveSize = m_reserveSize;
+	CriticalSection::exit();
+
+	return reserveSize > 0 ? this->data() + reserveStart : nullptr;
+}
+
+template <typename T>
+size_t BipBuffer<T>::maxReserveSize() const
+{
+	CriticalSection::enter();
+	size_t size;
+	if (m_bInUse)
+	{
+		size = m_aStart - m_bEnd;
+	}
+	else if (m_aStart == m_aEnd)
+	{
+		size = this->size();
+	}
+	else
+	{
+		size = std::max(this->size() - m_aEnd, m_aStart);
+	}
+	CriticalSection::exit();
+
+	return size;
+}
+
+template <typename T>
+void BipBuffer<T>::commitWrite(size_t size)
+{
+	CriticalSection::enter();
+	size = std::min(size, m_reserveSize);
+	if (size > 0)
+	{
+		// Region B could have been moved to region A by release() in the meantime, so compare positions.
+		if (m_reserveStart == m_aEnd)
+		{
+			m_aEnd += size;
+		}
+		else
+		{
+			m_bEnd = m_reserveStart + size;
+			m_bInUse = true;
+		}
+	}
+	m_reserveSize = 0;
+	CriticalSection::exit();
+}
+
+template <typename T>
+T* BipBuffer<T>::peekRead(size_t& size)
+{
+	CriticalSection::enter();
+	if (m_aStart == m_aEnd && m_bInUse)
+	{
+		m_aStart = 0;
+		m_aEnd = m_bEnd;
+		m_bEnd = 0;
+		m_bInUse = false;
+	}
+	size_t start = m_aStart;
+	size = m_aEnd - m_aStart;
+	CriticalSection::exit();
+
+	return size > 0 ? this->data() + start : nullptr;
+}
+
+template <typename T>
+void BipBuffer<T>::release(size_t size)
+{
+	CriticalSection::enter();
+	m_aStart += std::min(size, m_aEnd - m_aStart);
+	if (m_aStart == m_aEnd && m_bInUse)
+	{
+		m_aStart = 0;
+		m_aEnd = m_bEnd;
+		m_bEnd = 0;
+		m_bInUse = false;
+	}
+	CriticalSection::exit();
+}
+
+template <typename T>
+T& BipBuffer<T>::operator[](size_t pos) const
+{
+#if defined(DEBUG) || defined(USE_SEMF_DEBUG)
+	if (pos >= count())
+	{
+		T* p = nullptr;
+		return *p;
+	}
+#endif
+
+	CriticalSection::enter();
+	size_t aSize = m_aEnd - m_aStart;
+	T& data = pos < aSize ? this->data()[m_aStart + pos] : this->data()[pos - aSize];
+	CriticalSection::exit();
+
+	return data;
+}
+
+template <typename T>
+size_t BipBuffer<T>::count() const
+{
+	CriticalSection::enter();
+	size_t counter = (m_aEnd - m_aStart) + (m_bInUse ? m_bEnd : 0);
+	CriticalSection::exit();
+
+	return counter;
+}
+
+template <typename T>
+bool BipBuffer<T>::isEmpty() const
+{
+	return count() == 0;
+}
+
+template <typename T>
+void BipBuffer<T>::reset()
+{
+	CriticalSection::enter();
+	m_aStart = 0;
+	m_aEnd = 0;
+	m_bEnd = 0;
+	m_bInUse = false;
+	m_reserveSize = 0;
+	CriticalSection::exit();
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_CORE_BUFFER_BIPBUFFER_H_ */
@@ -51,7 +51,7 @@ public:
 	 * @brief Fills the whole buffer with the same object content.
 	 * @param data The data which should be written into the whole buffer.
 	 */
-	void fill(T data);
+	virtual void fill(T data);
 	/**
 	 * @brief Returns the entry from a specific position in the buffer.
 	 * @param pos Position in the buffer.
@@ -0,0 +1,179 @@
+/**
+ * @file movingaveragebuffer.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_CORE_BUFFER_MOVINGAVERAGEBUFFER_H_
+#define SEMF_UTILS_CORE_BUFFER_MOVINGAVERAGEBUFFER_H_
+
+#include <semf/utils/core/buffer/lastinbuffer.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace semf
+{
+/**
+ * @brief \c MovingAverageBuffer is a \c LastInBuffer, which keeps the sum of its entries up to date.
+ *
+ * On every \c put() the overwritten entry is subtracted from the sum and the new entry is added, so \c average()
+ * does not need to sum up the whole buffer like \c Average does.
+ *
+ * Until the buffer is filled completely, the average is built over the entries put so far.
+ * Entries already stored in the array when it is set are ignored, so the buffer starts empty.
+ *
+ * @note For using \c MovingAverageBuffer a global \c CriticalSection object is required.
+ * @note The sum is stored in 64 bit for integer types, so for 64 bit types the sum of all entries has to fit into
+ *       64 bit. For floating point types the sum has the type \c T. Because adding and subtracting accumulates
+ *       rounding errors, the sum of a floating point buffer is recalculated from the entries every time the write
+ *       position wraps around, which makes every \c size() th \c put() take linear time.
+ * @note Only \c put() and \c fill() of this class update the sum, so the entries must not be written directly.
+ *       \c setBuffer() is not virtual in \c Buffer, so a new array has to be set through \c MovingAverageBuffer,
+ *       otherwise the sum of the previous array is kept.
+ *
+ * @tparam Type of data to handle.
+ */
+template <typename T>
+class MovingAverageBuffer : public LastInBuffer<T>
+{
+public:
+	/**Type of the sum.*/
+	typedef typename std::conditional<std::is_floating_point<T>::value, T,
+									  typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>::type Sum;
+
+	using LastInBuffer<T>::LastInBuffer;
+	virtual ~MovingAverageBuffer() = default;
+
+	/**
+	 * @brief Writes data in the buffer and updates the sum.
+	 * @param data Data to write in the buffer.
+	 */
+	void put(T data) override;
+	/**
+	 * @brief Fills the whole buffer with the same object content.
+	 * @param data The data which should be written into the whole buffer.
+	 */
+	void fill(T data) override;
+	/**
+	 * @brief Sets a new array and empties the buffer.
+	 * @param buffer Array for storing the entries.
+	 * @param bufferSize Size of the array.
+	 */
+	void setBuffer(T buffer[], size_t bufferSize);
+	/**Empties the buffer.*/
+	void reset();
+	/**
+	 * @brief Returns the number of entries stored in the buffer.
+	 * @return Number of entries, at most \c size().
+	 */
+	size_t count() const override;
+	/**
+	 * @brief Returns the sum of all entries.
+	 * @return Sum.
+	 */
+	Sum sum() const;
+	/**
+	 * @brief Returns the average of all entries.
+	 * @note Integer averages are rounded towards zero.
+	 * @return Average, zero if the buffer is empty.
+	 */
+	T average() const;
+
+private:
+	/**
+	 * @brief Recalculates the sum from the entries.
+	 * @note Has to be called inside a critical section.
+	 */
+	void recalculateSum();
+
+	/**Sum of all entries.*/
+	Sum m_sum = 0;
+	/**Number of entries.*/
+	size_t m_count = 0;
+};
+
+template <typename T>
+void MovingAverageBuffer<T>::put(T data)
+{
+	CriticalSection::enter();
+	if (m_count == this->size())
+		m_sum -= this->data()[this->pos()];
+	else
+		m_count++;
+	m_sum += data;
+	LastInBuffer<T>::put(data);
+	if (std::is_floating_point<T>::value && this->pos() == 0)
+		recalculateSum();
+	CriticalSection::exit();
+}
+
+template <typename T>
+void MovingAverageBuffer<T>::fill(T data)
+{
+	CriticalSection::enter();
+	LastInBuffer<T>::fill(data);
+	m_count = this->size();
+	m_sum = static_cast<Sum>(data) * static_cast<Sum>(m_count);
+	CriticalSection::exit();
+}
+
+template <typename T>
+void MovingAverageBuffer<T>::setBuffer(T buffer[], size_t bufferSize)
+{
+	CriticalSection::enter();
+	LastInBuffer<T>::setBuffer(buffer, bufferSize);
+	reset();
+	CriticalSection::exit();
+}
+
+template <typename T>
+void MovingAverageBuffer<T>::reset()
+{
+	CriticalSection::enter();
+	m_sum = 0;
+	m_count = 0;
+	this->setPos(0);
+	CriticalSection::exit();
+}
+
+template <typename T>
+size_t MovingAverageBuffer<T>::count() const
+{
+	return m_count;
+}
+
+template <typename T>
+typename MovingAverageBuffer<T>::Sum MovingAverageBuffer<T>::sum() const
+{
+	CriticalSection::enter();
+	Sum sum = m_sum;
+	CriticalSection::exit();
+	return sum;
+}
+
+template <typename T>
+T MovingAverageBuffer<T>::average() const
+{
+	CriticalSection::enter();
+	Sum sum = m_sum;
+	size_t count = m_count;
+	CriticalSection::exit();
+
+	if (count == 0)
+		return 0;
+	return static_cast<T>(sum / static_cast<Sum>(count));
+}
+
+template <typename T>
+void MovingAverageBuffer<T>::recalculateSum()
+{
+	Sum sum = 0;
+	for (size_t i = 0; i < m_count; i++)
+		sum += this->data()[i];
+	m_sum = sum;
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_CORE_BUFFER_MOVINGAVERAGEBUFFER_H_ */
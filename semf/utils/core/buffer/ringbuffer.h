@@ -11,6 +11,10 @@
 #define SEMF_UTILS_CORE_BUFFER_RINGBUFFER_H_
 
 #include <semf/utils/core/buffer/buffer.h>
+#include <algorithm>
+#if __cplusplus > 201703L
+#include <span>
+#endif
 
 namespace semf
 {
@@ -27,6 +31,9 @@ namespace semf
  *
  * The data can be stored in the buffer by the function \c put().
  *
+ * For moving multiple entries at once use \c putBulk() and \c getBulk(). They copy the data in at most
+ * two contiguous chunks around the wrap point of the array and enter the \c CriticalSection only once.
+ *
  * See also \c Buffer, \c LastInBuffer, \c LastInDmaBuffer and \c Average.
  *
  * @note For using \c RingBuffer a global \c CriticalSection object is required.
@@ -53,6 +60,34 @@ public:
 	 *       function will dereference a \c nullptr in order to crash the software forcefully.
 	 */
 	T& get();
+	/**
+	 * @brief Writes multiple entries in the buffer.
+	 * @param data Pointer to the entries to write.
+	 * @param dataSize Number of entries to write.
+	 * @return Number of entries written, can be less than \c dataSize if the buffer gets full.
+	 */
+	size_t putBulk(const T* data, size_t dataSize);
+	/**
+	 * @brief Reads and removes multiple of the oldest entries not read yet.
+	 * @param buffer Pointer to the array to store the entries in.
+	 * @param bufferSize Maximum number of entries to read.
+	 * @return Number of entries read, can be less than \c bufferSize if the buffer gets empty.
+	 */
+	size_t getBulk(T* buffer, size_t bufferSize);
+#if __cplusplus > 201703L
+	/**
+	 * @brief Writes multiple entries in the buffer.
+	 * @param data Entries to write.
+	 * @return Number of entries written, can be less than \c data.size() if the buffer gets full.
+	 */
+	size_t putBulk(std::span<const T> data);
+	/**
+	 * @brief Reads and removes multiple of the oldest entries not read yet.
+	 * @param buffer Array to store the entries in.
+	 * @return Number of entries read, can be less than \c buffer.size() if the buffer gets empty.
+	 */
+	size_t getBulk(std::span<T> buffer);
+#endif
 	/**
 	 * @brief Returns the entry from a specific position in the buffer.
 	 * @param pos Position in the buffer.
@@ -130,6 +165,62 @@ T& RingBuffer<T>::get()
 	return data;
 }
 
+template <typename T>
+size_t RingBuffer<T>::putBulk(const T* data, size_t dataSize)
+{
+	if (data == nullptr || this->size() == 0)
+	{
+		return 0;
+	}
+
+	CriticalSection::enter();
+	size_t toWrite = std::min(dataSize, this->size() - m_dataCounter);
+	size_t start = (m_writePos + 1) % this->size();
+	size_t firstChunk = std::min(toWrite, this->size() - start);
+	std::copy_n(data, firstChunk, this->data() + start);
+	std::copy_n(data + firstChunk, toWrite - firstChunk, this->data());
+	m_writePos = (m_writePos + toWrite) % this->size();
+	m_dataCounter += toWrite;
+	CriticalSection::exit();
+
+	return toWrite;
+}
+
+template <typename T>
+size_t RingBuffer<T>::getBulk(T* buffer, size_t bufferSize)
+{
+	if (buffer == nullptr || this->size() == 0)
+	{
+		return 0;
+	}
+
+	CriticalSection::enter();
+	size_t toRead = std::min(bufferSize, m_dataCounter);
+	size_t start = (m_readPos + 1) % this->size();
+	size_t firstChunk = std::min(toRead, this->size() - start);
+	std::copy_n(this->data() + start, firstChunk, buffer);
+	std::copy_n(this->data(), toRead - firstChunk, buffer + firstChunk);
+	m_readPos = (m_readPos + toRead) % this->size();
+	m_dataCounter -= toRead;
+	CriticalSection::exit();
+
+	return toRead;
+}
+
+#if __cplusplus > 201703L
+template <typename T>
+size_t RingBuffer<T>::putBulk(std::span<const T> data)
+{
+	return putBulk(data.data(), data.size());
+}
+
+template <typename T>
+size_t RingBuffer<T>::getBulk(std::span<T> buffer)
+{
+	return getBulk(buffer.data(), buffer.size());
+}
+#endif
+
 template <typename T>
 T& RingBuffer<T>::operator[](size_t pos) const
 {
@@ -0,0 +1,222 @@
+/**
+ * @file spscringbuffer.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_CORE_BUFFER_SPSCRINGBUFFER_H_
+#define SEMF_UTILS_CORE_BUFFER_SPSCRINGBUFFER_H_
+
+#include <semf/utils/core/buffer/buffer.h>
+#include <atomic>
+
+namespace semf
+{
+/**
+ * @brief The \c SpscRingBuffer class implements a lock-free single producer, single consumer circular buffer.
+ *
+ * Compared to \c RingBuffer, \c SpscRingBuffer does not use \c CriticalSection for accessing the data.
+ * The read and write positions are atomic counters with acquire / release ordering, so one producer
+ * (e.g. an interrupt service routine) and one consumer (e.g. the main loop) can access the buffer concurrently
+ * without disabling interrupts. The counters run modulo twice the buffer size, so the array index stays in sync
+ * for every buffer size and a full buffer can be told apart from an empty one without a division.
+ *
+ * The data base is an array with the data type defined by the template parameter \c T.
+ * To use the \c SpscRingBuffer set the array in the constructor or by the function \c setBuffer().
+ * All entries of the array are usable.
+ *
+ * The data can be stored in the buffer by the function \c put() (producer side only) and
+ * read by the function \c get() (consumer side only).
+ *
+ * See also \c Buffer, \c RingBuffer, \c LastInBuffer, \c LastInDmaBuffer and \c Average.
+ *
+ * @attention Only one producer and one consumer context is allowed. \c setBuffer() and \c reset() must not be called
+ *            while the buffer is in use by another context.
+ * @attention If \c USE_SEMF_DEBUG or \c DEBUG is defined \c SpscRingBuffer uses \c nullptr dereferencing instead of an \c error signal.
+ *
+ * @tparam T Type of data to handle.
+ */
+template <typename T>
+class SpscRingBuffer : public Buffer<T>
+{
+public:
+	using Buffer<T>::Buffer;
+
+	/**
+	 * @brief Writes data in the buffer.
+	 * @note Must only be called from the producer context.
+	 * @param data Data to write into the buffer into the next free space.
+	 * @return \c true if the data was written, \c false if the buffer is full.
+	 */
+	bool put(T data);
+	/**
+	 * @brief Returns the oldest value not read yet and removes it from the buffer.
+	 * @note Must only be called from the consumer context.
+	 * @note Because the entry is released for the producer, the value is returned as a copy.
+	 * @return Oldest entry not read yet.
+	 * @note Using this function while \c USE_SEMF_DEBUG or \c DEBUG being defined will cause a boundary check. In case of failing the boundary check the
+	 *       function will dereference a \c nullptr in order to crash the software forcefully.
+	 */
+	T get();
+	/**
+	 * @brief Reads the oldest value not read yet and removes it from the buffer.
+	 * @note Must only be called from the consumer context.
+	 * @param data Reference to store the oldest entry in.
+	 * @return \c true if an entry was read, \c false if the buffer is empty.
+	 */
+	bool get(T& data);
+	/**
+	 * @brief Returns the entry from a specific position in the buffer without removing it.
+	 * @note Must only be called from the consumer context.
+	 * @param pos Position in the buffer, \c 0 is the oldest entry not read yet.
+	 * @return Entry.
+	 * @note Using this function while \c USE_SEMF_DEBUG or \c DEBUG being defined will cause a boundary check. In case of failing the boundary check the
+	 *       function will dereference a \c nullptr in order to crash the software forcefully.
+	 */
+	T& operator[](size_t pos) const override;
+	/**
+	 * @brief Returns if the buffer is full.
+	 * @return \li true: Buffer array is full.
+	 * 		   \li false: Buffer array is has still free space.
+	 */
+	bool isFull() const;
+	/**
+	 * @brief Returns if the buffer is empty.
+	 * @return \li true: No unread data available.
+	 * 		   \li false: Unread data available.
+	 */
+	bool isEmpty() const;
+	/**
+	 * @brief Returns the number of entries stored in the buffer and not read yet.
+	 * @return Number of entries.
+	 */
+	size_t count() const override;
+	/**
+	 * @brief Clears the buffer.
+	 * @note The data in the base array will not be modified.
+	 */
+	void reset();
+
+private:
+	/**
+	 * @brief Returns the array index of a counter value.
+	 * @param counter Counter value between \c 0 and twice the size.
+	 * @return Array index.
+	 */
+	size_t index(size_t counter) const;
+	/**
+	 * @brief Returns the counter value following \c counter.
+	 * @param counter Counter value between \c 0 and twice the size.
+	 * @return Next counter value.
+	 */
+	size_t next(size_t counter) const;
+
+	/**Counter of written entries modulo twice the size, only modified by the producer*/
+	std::atomic<size_t> m_writeCounter{0};
+	/**Counter of read entries modulo twice the size, only modified by the consumer*/
+	std::atomic<size_t> m_readCounter{0};
+};
+
+template <typename T>
+bool SpscRingBuffer<T>::put(T data)
+{
+	if (isFull())
+	{
+		return false;
+	}
+
+	size_t write = m_writeCounter.load(std::memory_order_relaxed);
+	this->data()[index(write)] = data;
+	m_writeCounter.store(next(write), std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+T SpscRingBuffer<T>::get()
+{
+#if defined(DEBUG) || defined(USE_SEMF_DEBUG)
+	if (isEmpty())
+	{
+		T* p = nullptr;
+		return *p;
+	}
+#endif
+
+	size_t read = m_readCounter.load(std::memory_order_relaxed);
+	T data = this->data()[index(read)];
+	m_readCounter.store(next(read), std::memory_order_release);
+	return data;
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::get(T& data)
+{
+	size_t read = m_readCounter.load(std::memory_order_relaxed);
+	if (read == m_writeCounter.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	data = this->data()[index(read)];
+	m_readCounter.store(next(read), std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+T& SpscRingBuffer<T>::operator[](size_t pos) const
+{
+#if defined(DEBUG) || defined(USE_SEMF_DEBUG)
+	if (pos >= count())
+	{
+		T* p = nullptr;
+		return *p;
+	}
+#endif
+
+	size_t read = index(m_readCounter.load(std::memory_order_relaxed)) + pos;
+	return this->data()[read < this->size() ? read : read - this->size()];
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::isFull() const
+{
+	return count() >= this->size();
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::isEmpty() const
+{
+	return count() == 0;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::count() const
+{
+	size_t read = m_readCounter.load(std::memory_order_acquire);
+	size_t write = m_writeCounter.load(std::memory_order_acquire);
+	return write >= read ? write - read : write + 2 * this->size() - read;
+}
+
+template <typename T>
+void SpscRingBuffer<T>::reset()
+{
+	m_readCounter.store(0, std::memory_order_relaxed);
+	m_writeCounter.store(0, std::memory_order_release);
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::index(size_t counter) const
+{
+	return counter < this->size() ? counter : counter - this->size();
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::next(size_t counter) const
+{
+	return counter + 1 < 2 * this->size() ? counter + 1 : 0;
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_CORE_BUFFER_SPSCRINGBUFFER_H_ */
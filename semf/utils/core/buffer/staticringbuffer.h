@@ -0,0 +1,195 @@
+/**
+ * @file staticringbuffer.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_CORE_BUFFER_STATICRINGBUFFER_H_
+#define SEMF_UTILS_CORE_BUFFER_STATICRINGBUFFER_H_
+
+#include <semf/utils/core/buffer/buffer.h>
+#include <array>
+
+namespace semf
+{
+/**
+ * @brief The \c StaticRingBuffer class implements a classic circular buffer with a compile time size.
+ *
+ * Compared to \c RingBuffer, \c StaticRingBuffer owns its data array and its size has to be a power of two.
+ * Because the size is known at compile time, the positions are calculated by masking free-running counters
+ * instead of using a modulo operation, which is a real division on small cores like Cortex-M0.
+ *
+ * The data can be accessed by the functions
+ * - \c data() to get the pointer to the data array,
+ * - \c operator[]() to get the element on a specific position and
+ * - \c get() to get the oldest entry not read jet.
+ *
+ * The data can be stored in the buffer by the function \c put().
+ *
+ * See also \c Buffer, \c RingBuffer, \c LastInBuffer, \c LastInDmaBuffer and \c Average.
+ *
+ * @note For using \c StaticRingBuffer a global \c CriticalSection object is required.
+ *
+ * @attention If \c USE_SEMF_DEBUG or \c DEBUG is defined \c StaticRingBuffer uses \c nullptr dereferencing instead of an \c error signal.
+ *
+ * @tparam T Type of data to handle.
+ * @tparam N Number of entries, must be a power of two.
+ */
+template <typename T, size_t N>
+class StaticRingBuffer : public Buffer<T>
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "StaticRingBuffer size must be a power of two");
+
+public:
+	StaticRingBuffer();
+	explicit StaticRingBuffer(const StaticRingBuffer& other) = delete;
+	virtual ~StaticRingBuffer() = default;
+
+	/**The buffer always uses its own array, it cannot be replaced.*/
+	void setBuffer(T buffer[], size_t bufferSize) = delete;
+
+	/**
+	 * @brief Writes data in the buffer.
+	 * @param data Data to write into the buffer into the next free space.
+	 */
+	virtual void put(T data);
+	/**
+	 * @brief Returns the oldest value not read yet.
+	 * @return Oldest entry not read yet.
+	 * @note Using this function while \c USE_SEMF_DEBUG or \c DEBUG being defined will cause a boundary check. In case of failing the boundary check the
+	 *       function will dereference a \c nullptr in order to crash the software forcefully.
+	 */
+	T& get();
+	/**
+	 * @brief Returns the entry from a specific position in the buffer.
+	 * @param pos Position in the buffer, \c 0 is the oldest entry not read yet.
+	 * @return Entry.
+	 * @note Using this function while \c USE_SEMF_DEBUG or \c DEBUG being defined will cause a boundary check. In case of failing the boundary check the
+	 *       function will dereference a \c nullptr in order to crash the software forcefully.
+	 */
+	T& operator[](size_t pos) const override;
+	/**
+	 * @brief Returns if the buffer is full.
+	 * @note If the buffer is full use \c get() to free a buffer entry place before \c put().
+	 * @return \li true: Buffer array is full.
+	 * 		   \li false: Buffer array is has still free space.
+	 */
+	bool isFull() const;
+	/**
+	 * @brief Returns if the buffer is empty.
+	 * @return \li true: No unread data available.
+	 * 		   \li false: Unread data available.
+	 */
+	bool isEmpty() const;
+	/**
+	 * @brief Returns the number of entries stored in the buffer and not read yet.
+	 * @return Number of entries.
+	 */
+	size_t count() const override;
+	/**
+	 * @brief Clears the buffer.
+	 * @note The data in the base array will not be modified.
+	 */
+	void reset();
+
+private:
+	/**Mask for calculating the array index from a counter*/
+	static constexpr size_t kMask = N - 1;
+	/**The array for saving the data in, mutable because \c operator[]() returns a modifiable entry*/
+	mutable std::array<T, N> m_storage;
+	/**Free-running counter of written entries*/
+	size_t m_writeCounter = 0;
+	/**Free-running counter of read entries*/
+	size_t m_readCounter = 0;
+};
+
+template <typename T, size_t N>
+StaticRingBuffer<T, N>::StaticRingBuffer()
+: Buffer<T>(m_storage.data(), N)
+{
+}
+
+template <typename T, size_t N>
+void StaticRingBuffer<T, N>::put(T data)
+{
+	CriticalSection::enter();
+	if (m_writeCounter - m_readCounter < N)
+	{
+		m_storage[m_writeCounter & kMask] = data;
+		++m_writeCounter;
+	}
+	CriticalSection::exit();
+}
+
+template <typename T, size_t N>
+T& StaticRingBuffer<T, N>::get()
+{
+#if defined(DEBUG) || defined(USE_SEMF_DEBUG)
+	if (isEmpty())
+	{
+		T* p = nullptr;
+		return *p;
+	}
+#endif
+
+	CriticalSection::enter();
+	T& data = m_storage[m_readCounter & kMask];
+	++m_readCounter;
+	CriticalSection::exit();
+
+	return data;
+}
+
+template <typename T, size_t N>
+T& StaticRingBuffer<T, N>::operator[](size_t pos) const
+{
+#if defined(DEBUG) || defined(USE_SEMF_DEBUG)
+	if (pos >= count())
+	{
+		T* p = nullptr;
+		return *p;
+	}
+#endif
+
+	CriticalSection::enter();
+	T& data = m_storage[(m_readCounter + pos) & kMask];
+	CriticalSection::exit();
+
+	return data;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::isFull() const
+{
+	return count() == N;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::isEmpty() const
+{
+	return count() == 0;
+}
+
+template <typename T, size_t N>
+size_t StaticRingBuffer<T, N>::count() const
+{
+	CriticalSection::enter();
+	size_t counter = m_writeCounter - m_readCounter;
+	CriticalSection::exit();
+
+	return counter;
+}
+
+template <typename T, size_t N>
+void StaticRingBuffer<T, N>::reset()
+{
+	CriticalSection::enter();
+	m_writeCounter = 0;
+	m_readCounter = 0;
+	CriticalSection::exit();
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_CORE_BUFFER_STATICRINGBUFFER_H_ */
@@ -72,6 +72,10 @@ public:
 		UartHardware,
 		OneWireMaster,
 		OneWireMasterUart,
+		ReedSolomon,
+		I2cBusScheduler,
+		AesCbcSoftware,
+		AesCtrSoftware,
 
 		SectionHardwareBegin = 0x08000000,
 
@@ -0,0 +1,236 @@
+/**
+ * @file mpscqueue.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_CORE_QUEUES_MPSCQUEUE_H_
+#define SEMF_UTILS_CORE_QUEUES_MPSCQUEUE_H_
+
+#include <semf/utils/core/debug.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief \c MpscQueue is a fixed-capacity lock-free multiple producer, single consumer FIFO queue.
+ *
+ * Elements can be pushed from any context, e.g. from interrupt service routines with different priorities
+ * and from the main loop at the same time. Only one context is allowed to pop elements.
+ *
+ * Every array entry holds a sequence number next to the element. A producer claims an entry by a compare-and-swap
+ * on the write position and publishes it by updating the sequence number, so no \c CriticalSection is needed.
+ * The sequence numbers only count the rounds through the array, so a zero initialized array is a valid empty queue.
+ *
+ * Besides copying elements by \c push() and \c pop(), an element can be written in place by \c claim() and
+ * \c publish() and handled in place by \c front() and \c release(), e.g. for elements holding a packed
+ * argument buffer like the events of \c EventLoop.
+ *
+ * @note The queue capacity is the biggest power of two not bigger than the size of the given array.
+ *       The array needs at least two entries, with a smaller array every \c push() fails.
+ * @attention The array has to be constructed before the queue is used, so it must not be a member of a class
+ *            derived from the class owning the queue.
+ * @note On cores without exclusive access instructions (e.g. Cortex-M0) \c std::atomic may fall back to a locking
+ *       implementation of the toolchain.
+ *
+ * @tparam T Type of the elements, has to be copy assignable.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+	/**
+	 * @brief Queue array entry.
+	 */
+	struct Entry
+	{
+		/**Sequence number for synchronizing producers and consumer.*/
+		std::atomic<size_t> sequence{0};
+		/**Element.*/
+		T data;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param queue Array of entries for storing elements.
+	 * @param queueSize Number of entries in the array, at least two.
+	 */
+	MpscQueue(Entry queue[], size_t queueSize);
+	explicit MpscQueue(const MpscQueue& other) = delete;
+	virtual ~MpscQueue() = default;
+
+	/**
+	 * @brief Adds an element to the end of the queue.
+	 * @note Can be called from any context.
+	 * @param data Element to add.
+	 * @return \c true for added, \c false if the queue is full.
+	 */
+	bool push(const T& data);
+	/**
+	 * @brief Removes the first element of the queue.
+	 * @attention Must only be called from the consumer context.
+	 * @param data Reference to store the removed element in.
+	 * @return \c true for removed, \c false if the queue is empty.
+	 */
+	bool pop(T& data);
+	/**
+	 * @brief Claims the next free entry for writing an element in place.
+	 * @note Can be called from any context. Every claimed entry has to be handed over by \c publish(),
+	 *       the consumer waits for it before handling later elements.
+	 * @param pos Returns the position of the claimed entry for \c publish().
+	 * @return Element of the claimed entry, \c nullptr if the queue is full.
+	 */
+	T* claim(size_t& pos);
+	/**
+	 * @brief Makes an element written after \c claim() visible for the consumer.
+	 * @param pos Position returned by \c claim().
+	 */
+	void publish(size_t pos);
+	/**
+	 * @brief Returns the first element of the queue without removing it.
+	 * @attention Must only be called from the consumer context.
+	 * @return First element, \c nullptr if the queue is empty.
+	 */
+	T* front();
+	/**
+	 * @brief Removes the first element returned by \c front().
+	 * @attention Must only be called from the consumer context and only if \c front() returned an element.
+	 */
+	void release();
+	/**
+	 * @brief Returns if the queue is empty.
+	 * @attention Must only be called from the consumer context.
+	 * @return \c true if the queue is empty, \c false otherwise.
+	 */
+	bool empty() const;
+	/**
+	 * @brief Returns the number of elements the queue can hold.
+	 * @return Capacity.
+	 */
+	size_t capacity() const;
+
+private:
+	/**Queue array.*/
+	Entry* m_queue;
+	/**Mask for calculating the array index from a position.*/
+	size_t m_mask = 0;
+	/**Next position to push to.*/
+	std::atomic<size_t> m_pushPos{0};
+	/**Next position to pop from.*/
+	size_t m_popPos = 0;
+};
+
+template <typename T>
+MpscQueue<T>::MpscQueue(Entry queue[], size_t queueSize)
+: m_queue(queue)
+{
+	// With one entry a published element would look like a free entry of the next round.
+	if (queue == nullptr || queueSize < 2)
+	{
+		SEMF_ERROR("queue size smaller than 2");
+		m_queue = nullptr;
+		return;
+	}
+	size_t capacity = 2;
+	while (capacity <= queueSize / 2)
+		capacity <<= 1;
+	m_mask = capacity - 1;
+}
+
+template <typename T>
+bool MpscQueue<T>::push(const T& data)
+{
+	size_t pos;
+	T* element = claim(pos);
+	if (element == nullptr)
+		return false;
+
+	*element = data;
+	publish(pos);
+	return true;
+}
+
+template <typename T>
+bool MpscQueue<T>::pop(T& data)
+{
+	T* element = front();
+	if (element == nullptr)
+		return false;
+
+	data = *element;
+	release();
+	return true;
+}
+
+template <typename T>
+T* MpscQueue<T>::claim(size_t& pos)
+{
+	if (m_queue == nullptr)
+		return nullptr;
+
+	pos = m_pushPos.load(std::memory_order_relaxed);
+	while (true)
+	{
+		Entry& entry = m_queue[pos & m_mask];
+		size_t round = pos & ~m_mask;
+		size_t sequence = entry.sequence.load(std::memory_order_acquire);
+		if (sequence == round)
+		{
+			if (m_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				return &entry.data;
+		}
+		else if (static_cast<std::ptrdiff_t>(sequence - round) < 0)
+		{
+			// Entry still holds an element from the previous round: the queue is full.
+			return nullptr;
+		}
+		else
+		{
+			pos = m_pushPos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+template <typename T>
+void MpscQueue<T>::publish(size_t pos)
+{
+	m_queue[pos & m_mask].sequence.store((pos & ~m_mask) + 1, std::memory_order_release);
+}
+
+template <typename T>
+T* MpscQueue<T>::front()
+{
+	if (empty())
+		return nullptr;
+
+	return &m_queue[m_popPos & m_mask].data;
+}
+
+template <typename T>
+void MpscQueue<T>::release()
+{
+	m_queue[m_popPos & m_mask].sequence.store((m_popPos & ~m_mask) + m_mask + 1, std::memory_order_release);
+	m_popPos++;
+}
+
+template <typename T>
+bool MpscQueue<T>::empty() const
+{
+	if (m_queue == nullptr)
+		return true;
+
+	return m_queue[m_popPos & m_mask].sequence.load(std::memory_order_acquire) != (m_popPos & ~m_mask) + 1;
+}
+
+template <typename T>
+size_t MpscQueue<T>::capacity() const
+{
+	return m_queue != nullptr ? m_mask + 1 : 0;
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_CORE_QUEUES_MPSCQUEUE_H_ */
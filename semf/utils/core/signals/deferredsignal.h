@@ -0,0 +1,173 @@
+/**
+ * @file deferredsignal.h
+ *
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory
+ */
+
+#ifndef SEMF_UTILS_CORE_SIGNALS_DEFERREDSIGNAL_H_
+#define SEMF_UTILS_CORE_SIGNALS_DEFERREDSIGNAL_H_
+
+#include <semf/system/eventloop.h>
+#include <semf/utils/core/signals/signal.h>
+#include <semf/utils/core/signals/slot.h>
+#include <tuple>
+#include <utility>
+
+namespace semf
+{
+/**
+ * @brief \c DeferredSignal is a \c Signal, which does not call its slots in the context of the emitter.
+ *
+ * Emitting a \c DeferredSignal packs the arguments and posts them into an \c EventLoop.
+ * The connected slots are called later by \c EventLoop::process() in the main loop, in the order the signals were emitted.
+ * This keeps the time spent in interrupt service routines short and avoids reentrancy in the slots.
+ *
+ * A normal \c Signal, e.g. \c UartHardware::dataAvailable, can be forwarded into the main loop
+ * by connecting it to \c slot():
+ * @code
+ * semf::EventLoop::Entry queue[16];
+ * semf::EventLoop eventLoop(queue, 16);
+ * semf::DeferredSignal<> dataAvailable(eventLoop);
+ * uart.dataAvailable.connect(dataAvailable.slot());
+ * dataAvailable.connect(applicationSlot);
+ * while (true)
+ *     eventLoop.process();
+ * @endcode
+ *
+ * @tparam Arguments The parameter types for pass parameter over the signal to a function or method.
+ */
+template <typename... Arguments>
+class DeferredSignal : public EventLoop::Event
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param eventLoop Event loop to post the emitted signals into.
+	 */
+	explicit DeferredSignal(EventLoop& eventLoop);
+	explicit DeferredSignal(const DeferredSignal& other) = delete;
+	virtual ~DeferredSignal() = default;
+
+	/**Disconnect all functions or methods*/
+	void clear();
+	/**
+	 * @brief Connect a method to the signal.
+	 * @param slot The slot which should connect.
+	 */
+	void connect(SlotBase<Arguments...>& slot);
+	/**
+	 * @brief Disonnect a method from the signal.
+	 * @param slot The slot which should disconnect.
+	 */
+	void disconnect(SlotBase<Arguments...>& slot);
+	/**
+	 * @brief Posts the signal into the event loop. The connected methods or functions are called by \c EventLoop::process().
+	 * @param arguments The arguments which should pass to the methods or functions.
+	 * @return \c true for posted, \c false if the queue of the event loop is full.
+	 */
+	bool emitSignal(Arguments... arguments);
+	/**
+	 * @brief Posts the signal into the event loop. The connected methods or functions are called by \c EventLoop::process().
+	 * @param arguments The arguments which should pass to the methods or functions.
+	 * @return \c true for posted, \c false if the queue of the event loop is full.
+	 */
+	bool operator()(Arguments... arguments);
+	/**
+	 * @brief Checks if the \c DeferredSignal is connected to any slot.
+	 * @return \c true if no connection exists, \c false otherwise.
+	 */
+	bool empty() const;
+	/**
+	 * @brief Returns a slot calling \c emitSignal(), for forwarding a \c Signal into the event loop.
+	 * @return Slot to connect to a \c Signal.
+	 */
+	SlotBase<Arguments...>& slot();
+
+protected:
+	void dispatch(void* arguments) override;
+
+private:
+	/**
+	 * @brief Calls the connected slots with the unpacked arguments.
+	 * @tparam Indices Indices of the arguments in \c arguments.
+	 * @param arguments Packed arguments.
+	 */
+	template <size_t... Indices>
+	void emitUnpacked(std::tuple<Arguments...>& arguments, std::index_sequence<Indices...>);
+
+	/**Event loop the signals are posted into.*/
+	EventLoop& m_eventLoop;
+	/**Signal calling the connected slots in the main loop context.*/
+	Signal<Arguments...> m_signal;
+	/**Slot for forwarding another signal.*/
+	SEMF_SLOT(m_emitSlot, DeferredSignal, *this, emitSignal, Arguments...);
+};
+
+template <typename... Arguments>
+DeferredSignal<Arguments...>::DeferredSignal(EventLoop& eventLoop)
+: m_eventLoop(eventLoop)
+{
+}
+
+template <typename... Arguments>
+void DeferredSignal<Arguments...>::clear()
+{
+	m_signal.clear();
+}
+
+template <typename... Arguments>
+void DeferredSignal<Arguments...>::connect(SlotBase<Arguments...>& slot)
+{
+	m_signal.connect(slot);
+}
+
+template <typename... Arguments>
+void DeferredSignal<Arguments...>::disconnect(SlotBase<Arguments...>& slot)
+{
+	m_signal.disconnect(slot);
+}
+
+template <typename... Arguments>
+bool DeferredSignal<Arguments...>::emitSignal(Arguments... arguments)
+{
+	return m_eventLoop.post(*this, arguments...);
+}
+
+template <typename... Arguments>
+bool DeferredSignal<Arguments...>::operator()(Arguments... arguments)
+{
+	return m_eventLoop.post(*this, arguments...);
+}
+
+template <typename... Arguments>
+bool DeferredSignal<Arguments...>::empty() const
+{
+	return m_signal.empty();
+}
+
+template <typename... Arguments>
+SlotBase<Arguments...>& DeferredSignal<Arguments...>::slot()
+{
+	return m_emitSlot;
+}
+
+template <typename... Arguments>
+void DeferredSignal<Arguments...>::dispatch(void* arguments)
+{
+	auto* packed = static_cast<std::tuple<Arguments...>*>(arguments);
+	emitUnpacked(*packed, std::index_sequence_for<Arguments...>());
+	packed->~tuple();
+}
+
+template <typename... Arguments>
+template <size_t... Indices>
+void DeferredSignal<Arguments...>::emitUnpacked(std::tuple<Arguments...>& arguments, std::index_sequence<Indices...>)
+{
+	m_signal.emitSignal(std::get<Indices>(arguments)...);
+}
+}  // namespace semf
+#endif  // SEMF_UTILS_CORE_SIGNALS_DEFERREDSIGNAL_H_
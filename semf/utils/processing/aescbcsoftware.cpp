@@ -0,0 +1,71 @@
+/**
+ * @file aescbcsoftware.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/aescbcsoftware.h>
+#include <cstring>
+
+namespace semf
+{
+void AesCbcSoftware::setKey(const uint8_t key[], size_t size)
+{
+	if (!m_aes.setKey(key, size))
+		error(semf::Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::SetKey_SizeIsInvalid)));
+}
+
+void AesCbcSoftware::setInitializationVector(const uint8_t initializationVector[])
+{
+	std::memcpy(m_initializationVector, initializationVector, AesSoftware::kBlockSize);
+	std::memcpy(m_vector, initializationVector, AesSoftware::kBlockSize);
+}
+
+void AesCbcSoftware::resetInitializationVector()
+{
+	std::memcpy(m_vector, m_initializationVector, AesSoftware::kBlockSize);
+}
+
+AesCbcSoftware::State AesCbcSoftware::encrypt(const uint8_t dataIn[], uint8_t bufferOut[], size_t size)
+{
+	if (!m_aes.hasKey() || size % AesSoftware::kBlockSize != 0)
+	{
+		SEMF_ERROR("no key set or size %u is not a multiple of the block size", size);
+		return State::Error;
+	}
+
+	for (size_t pos = 0; pos < size; pos += AesSoftware::kBlockSize)
+	{
+		for (size_t i = 0; i < AesSoftware::kBlockSize; i++)
+			m_vector[i] ^= dataIn[pos + i];
+		m_aes.encryptBlock(m_vector, m_vector);
+		std::memcpy(&bufferOut[pos], m_vector, AesSoftware::kBlockSize);
+	}
+	return State::Ok;
+}
+
+AesCbcSoftware::State AesCbcSoftware::decrypt(const uint8_t dataIn[], uint8_t bufferOut[], size_t size)
+{
+	if (!m_aes.hasKey() || size % AesSoftware::kBlockSize != 0)
+	{
+		SEMF_ERROR("no key set or size %u is not a multiple of the block size", size);
+		return State::Error;
+	}
+
+	uint8_t block[AesSoftware::kBlockSize];
+	for (size_t pos = 0; pos < size; pos += AesSoftware::kBlockSize)
+	{
+		// The encrypted block is the next initialization vector, so it is saved before overwriting it in place.
+		std::memcpy(block, &dataIn[pos], AesSoftware::kBlockSize);
+		m_aes.decryptBlock(block, &bufferOut[pos]);
+		for (size_t i = 0; i < AesSoftware::kBlockSize; i++)
+			bufferOut[pos + i] ^= m_vector[i];
+		std::memcpy(m_vector, block, AesSoftware::kBlockSize);
+	}
+	return State::Ok;
+}
+} /* namespace semf */
@@ -0,0 +1,68 @@
+/**
+ * @file aescbcsoftware.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_AESCBCSOFTWARE_H_
+#define SEMF_UTILS_PROCESSING_AESCBCSOFTWARE_H_
+
+#include <semf/app/processing/aescbc.h>
+#include <semf/utils/core/error.h>
+#include <semf/utils/core/signals/signal.h>
+#include <semf/utils/processing/aessoftware.h>
+
+namespace semf
+{
+/**
+ * @brief AES-CBC encryption and decryption in software.
+ *
+ * The round keys are expanded once in \c setKey(). \c dataIn and \c bufferOut of \c encrypt() and \c decrypt() can
+ * point to the same buffer for working in place.
+ *
+ * @note The initialization vector has the AES block size of 16 bytes for all key sizes.
+ */
+class AesCbcSoftware : public app::AesCbc
+{
+public:
+	/**
+	 * @brief Error codes for this class. Error ID identify a unique error() / onError call (excluding transferring).
+	 */
+	enum class ErrorCode : uint8_t
+	{
+		SetKey_SizeIsInvalid = 0
+	};
+
+	AesCbcSoftware() = default;
+	explicit AesCbcSoftware(const AesCbcSoftware& other) = delete;
+	virtual ~AesCbcSoftware() = default;
+
+	/**
+	 * @copydoc app::AesCbc::setKey()
+	 * @throws SetKey_SizeIsInvalid If the key size is not 16, 24 or 32 bytes, \c encrypt() and \c decrypt()
+	 *         fail until a valid key is set.
+	 */
+	void setKey(const uint8_t key[], size_t size) override;
+	void setInitializationVector(const uint8_t initializationVector[]) override;
+	void resetInitializationVector() override;
+	State encrypt(const uint8_t dataIn[], uint8_t bufferOut[], size_t size) override;
+	State decrypt(const uint8_t dataIn[], uint8_t bufferOut[], size_t size) override;
+
+	/**Signal is emitted after an error occurred.*/
+	Signal<semf::Error> error;
+
+private:
+	/**Block cipher.*/
+	AesSoftware m_aes;
+	/**Initialization vector set by \c setInitializationVector().*/
+	uint8_t m_initializationVector[AesSoftware::kBlockSize] = {0};
+	/**Initialization vector for the next block.*/
+	uint8_t m_vector[AesSoftware::kBlockSize] = {0};
+	/**Class ID for error tracing.*/
+	static constexpr semf::Error::ClassID kSemfClassId = semf::Error::ClassID::AesCbcSoftware;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_AESCBCSOFTWARE_H_ */
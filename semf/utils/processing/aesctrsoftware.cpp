@@ -0,0 +1,91 @@
+/**
+ * @file aesctrsoftware.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/aesctrsoftware.h>
+#include <cstring>
+
+namespace semf
+{
+bool AesCtrSoftware::setKey(const uint8_t key[], size_t size)
+{
+	if (!m_aes.setKey(key, size))
+	{
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::SetKey_SizeIsInvalid)));
+		return false;
+	}
+	return true;
+}
+
+void AesCtrSoftware::setInitializationVector(const uint8_t initializationVector[])
+{
+	std::memcpy(m_initializationVector, initializationVector, AesSoftware::kBlockSize);
+	resetInitializationVector();
+}
+
+void AesCtrSoftware::resetInitializationVector()
+{
+	std::memcpy(m_counter, m_initializationVector, AesSoftware::kBlockSize);
+	m_keyStreamUsed = AesSoftware::kBlockSize;
+}
+
+bool AesCtrSoftware::crypt(const uint8_t dataIn[], uint8_t bufferOut[], size_t size)
+{
+	if (!m_aes.hasKey())
+	{
+		SEMF_ERROR("no key set");
+		return false;
+	}
+
+	for (size_t i = 0; i < size; i++)
+	{
+		if (m_keyStreamUsed == AesSoftware::kBlockSize)
+		{
+			m_aes.encryptBlock(m_counter, m_keyStream);
+			add(m_counter, 1);
+			m_keyStreamUsed = 0;
+		}
+		bufferOut[i] = dataIn[i] ^ m_keyStream[m_keyStreamUsed++];
+	}
+	return true;
+}
+
+bool AesCtrSoftware::cryptBlocks(const uint8_t dataIn[], uint8_t bufferOut[], size_t size, uint64_t blockIndex) const
+{
+	if (!m_aes.hasKey())
+	{
+		SEMF_ERROR("no key set");
+		return false;
+	}
+
+	uint8_t counter[AesSoftware::kBlockSize];
+	uint8_t keyStream[AesSoftware::kBlockSize];
+	std::memcpy(counter, m_initializationVector, AesSoftware::kBlockSize);
+	add(counter, blockIndex);
+	for (size_t pos = 0; pos < size; pos += AesSoftware::kBlockSize)
+	{
+		m_aes.encryptBlock(counter, keyStream);
+		add(counter, 1);
+		size_t blockSize = size - pos < AesSoftware::kBlockSize ? size - pos : AesSoftware::kBlockSize;
+		for (size_t i = 0; i < blockSize; i++)
+			bufferOut[pos + i] = dataIn[pos + i] ^ keyStream[i];
+	}
+	return true;
+}
+
+void AesCtrSoftware::add(uint8_t counter[], uint64_t value)
+{
+	for (size_t i = AesSoftware::kBlockSize; i > 0 && value != 0; i--)
+	{
+		uint32_t sum = counter[i - 1] + static_cast<uint32_t>(value & 0xff);
+		counter[i - 1] = static_cast<uint8_t>(sum);
+		value = (value >> 8) + (sum >> 8);
+	}
+}
+} /* namespace semf */
@@ -0,0 +1,107 @@
+/**
+ * @file aesctrsoftware.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_AESCTRSOFTWARE_H_
+#define SEMF_UTILS_PROCESSING_AESCTRSOFTWARE_H_
+
+#include <semf/utils/core/error.h>
+#include <semf/utils/core/signals/signal.h>
+#include <semf/utils/processing/aessoftware.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief AES-CTR (counter mode) encryption and decryption in software.
+ *
+ * The key stream is generated by encrypting a 16 byte big endian counter block, which is incremented for every
+ * block. Encryption and decryption are the same operation and the data does not need to be a multiple of the
+ * block size.
+ *
+ * \c crypt() works like a stream and continues with the rest of the last key stream block.
+ * \c cryptBlocks() only depends on the given block index and does not change the object, so host builds can split
+ * big buffers into parts and process them on multiple threads at the same time.
+ */
+class AesCtrSoftware
+{
+public:
+	/**
+	 * @brief Error codes for this class. Error ID identify a unique error() / onError call (excluding transferring).
+	 */
+	enum class ErrorCode : uint8_t
+	{
+		SetKey_SizeIsInvalid = 0
+	};
+
+	AesCtrSoftware() = default;
+	explicit AesCtrSoftware(const AesCtrSoftware& other) = delete;
+	virtual ~AesCtrSoftware() = default;
+
+	/**
+	 * @brief Sets the AES key.
+	 * @param key Pointer to the address of the key (as binary).
+	 * @param size Size of the key in bytes, 16, 24 or 32.
+	 * @return \c true for a valid key size, \c false otherwise.
+	 * @throws SetKey_SizeIsInvalid If the key size is not 16, 24 or 32 bytes.
+	 */
+	bool setKey(const uint8_t key[], size_t size);
+	/**
+	 * @brief Sets the initial counter block (nonce and counter) and restarts the stream.
+	 * @param initializationVector Pointer to the 16 byte initial counter block.
+	 */
+	void setInitializationVector(const uint8_t initializationVector[]);
+	/**Restarts the stream at the initial counter block.*/
+	void resetInitializationVector();
+	/**
+	 * @brief Encrypts or decrypts data continuing the stream of the previous call.
+	 * @param dataIn Input data.
+	 * @param bufferOut Output data, can be the same as \c dataIn.
+	 * @param size Size of the data in bytes.
+	 * @return \c true on success, \c false if no key is set.
+	 */
+	bool crypt(const uint8_t dataIn[], uint8_t bufferOut[], size_t size);
+	/**
+	 * @brief Encrypts or decrypts data starting at a block of the stream, independent from the stream position.
+	 * @note Can be called from multiple threads at the same time, as long as the key and the initialization vector
+	 *       are not changed.
+	 * @param dataIn Input data.
+	 * @param bufferOut Output data, can be the same as \c dataIn.
+	 * @param size Size of the data in bytes.
+	 * @param blockIndex Index of the block in the stream the data starts at.
+	 * @return \c true on success, \c false if no key is set.
+	 */
+	bool cryptBlocks(const uint8_t dataIn[], uint8_t bufferOut[], size_t size, uint64_t blockIndex) const;
+
+	/**Signal is emitted after an error occurred.*/
+	Signal<Error> error;
+
+private:
+	/**
+	 * @brief Adds a value to a big endian counter block.
+	 * @param counter Counter block.
+	 * @param value Value to add.
+	 */
+	static void add(uint8_t counter[], uint64_t value);
+
+	/**Block cipher.*/
+	AesSoftware m_aes;
+	/**Initial counter block.*/
+	uint8_t m_initializationVector[AesSoftware::kBlockSize] = {0};
+	/**Counter block for the next key stream block.*/
+	uint8_t m_counter[AesSoftware::kBlockSize] = {0};
+	/**Actual key stream block.*/
+	uint8_t m_keyStream[AesSoftware::kBlockSize] = {0};
+	/**Number of used bytes of \c m_keyStream.*/
+	size_t m_keyStreamUsed = AesSoftware::kBlockSize;
+	/**Class ID for error tracing.*/
+	static constexpr Error::ClassID kSemfClassId = Error::ClassID::AesCtrSoftware;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_AESCTRSOFTWARE_H_ */
@@ -0,0 +1,238 @@
+/**
+ * @file aessoftware.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/aessoftware.h>
+
+namespace semf
+{
+constexpr uint8_t AesSoftware::multiply(uint8_t a, uint8_t b)
+{
+	uint8_t product = 0;
+	while (b != 0)
+	{
+		if (b & 1)
+			product ^= a;
+		a = static_cast<uint8_t>((a << 1) ^ ((a & 0x80) ? 0x1b : 0x00));
+		b >>= 1;
+	}
+	return product;
+}
+
+constexpr AesSoftware::Tables AesSoftware::generateTables()
+{
+	Tables tables = {};
+	// Walk through all elements with the generator 3 and its inverse, so x * inverse == 1.
+	uint8_t x = 1;
+	uint8_t inverse = 1;
+	do
+	{
+		x = multiply(x, 3);
+		inverse = multiply(inverse, 0xf6);
+		uint8_t s = inverse;
+		for (int i = 1; i < 5; i++)
+			s ^= static_cast<uint8_t>((inverse << i) | (inverse >> (8 - i)));
+		s ^= 0x63;
+		tables.sbox[x] = s;
+	} while (x != 1);
+	tables.sbox[0] = 0x63;
+
+	for (size_t i = 0; i < 256; i++)
+	{
+		uint8_t s = tables.sbox[i];
+		tables.inverseSbox[s] = static_cast<uint8_t>(i);
+		tables.encrypt[i] = (static_cast<uint32_t>(multiply(s, 2)) << 24) | (static_cast<uint32_t>(s) << 16) |
+							(static_cast<uint32_t>(s) << 8) | multiply(s, 3);
+	}
+	for (size_t i = 0; i < 256; i++)
+	{
+		uint8_t s = tables.inverseSbox[i];
+		tables.decrypt[i] = (static_cast<uint32_t>(multiply(s, 14)) << 24) | (static_cast<uint32_t>(multiply(s, 9)) << 16) |
+							(static_cast<uint32_t>(multiply(s, 13)) << 8) | multiply(s, 11);
+	}
+	return tables;
+}
+
+const AesSoftware::Tables AesSoftware::kTables = AesSoftware::generateTables();
+
+bool AesSoftware::setKey(const uint8_t key[], size_t size)
+{
+	if (size != 16 && size != 24 && size != 32)
+	{
+		SEMF_ERROR("invalid key size %u", size);
+		m_rounds = 0;
+		return false;
+	}
+
+	size_t keyWords = size / 4;
+	m_rounds = keyWords + 6;
+	size_t words = (m_rounds + 1) * 4;
+	for (size_t i = 0; i < keyWords; i++)
+		m_encryptKeys[i] = load(&key[i * 4]);
+
+	uint32_t roundConstant = 0x01000000;
+	for (size_t i = keyWords; i < words; i++)
+	{
+		uint32_t temp = m_encryptKeys[i - 1];
+		if (i % keyWords == 0)
+		{
+			temp = substitute(rotateRight(temp, 24)) ^ roundConstant;
+			roundConstant = static_cast<uint32_t>(multiply(static_cast<uint8_t>(roundConstant >> 24), 2)) << 24;
+		}
+		else if (keyWords > 6 && i % keyWords == 4)
+		{
+			temp = substitute(temp);
+		}
+		m_encryptKeys[i] = m_encryptKeys[i - keyWords] ^ temp;
+	}
+
+	// Equivalent inverse cipher: round keys in reverse order and inverse mix columns for the inner rounds.
+	for (size_t round = 0; round <= m_rounds; round++)
+	{
+		for (size_t i = 0; i < 4; i++)
+		{
+			uint32_t k = m_encryptKeys[(m_rounds - round) * 4 + i];
+			if (round > 0 && round < m_rounds)
+			{
+				const uint8_t* sbox = kTables.sbox;
+				k = kTables.decrypt[sbox[k >> 24]] ^ rotateRight(kTables.decrypt[sbox[(k >> 16) & 0xff]], 8) ^
+					rotateRight(kTables.decrypt[sbox[(k >> 8) & 0xff]], 16) ^ rotateRight(kTables.decrypt[sbox[k & 0xff]], 24);
+			}
+			m_decryptKeys[round * 4 + i] = k;
+		}
+	}
+	SEMF_INFO("key set with %u rounds", m_rounds);
+	return true;
+}
+
+bool AesSoftware::hasKey() const
+{
+	return m_rounds != 0;
+}
+
+void AesSoftware::encryptBlock(const uint8_t dataIn[], uint8_t bufferOut[]) const
+{
+	const uint32_t* key = m_encryptKeys;
+	const uint32_t* t = kTables.encrypt;
+	uint32_t s0 = load(&dataIn[0]) ^ key[0];
+	uint32_t s1 = load(&dataIn[4]) ^ key[1];
+	uint32_t s2 = load(&dataIn[8]) ^ key[2];
+	uint32_t s3 = load(&dataIn[12]) ^ key[3];
+
+	for (size_t round = 1; round < m_rounds; round++)
+	{
+		key += 4;
+		uint32_t t0 = t[s0 >> 24] ^ rotateRight(t[(s1 >> 16) & 0xff], 8) ^ rotateRight(t[(s2 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s3 & 0xff], 24) ^ key[0];
+		uint32_t t1 = t[s1 >> 24] ^ rotateRight(t[(s2 >> 16) & 0xff], 8) ^ rotateRight(t[(s3 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s0 & 0xff], 24) ^ key[1];
+		uint32_t t2 = t[s2 >> 24] ^ rotateRight(t[(s3 >> 16) & 0xff], 8) ^ rotateRight(t[(s0 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s1 & 0xff], 24) ^ key[2];
+		uint32_t t3 = t[s3 >> 24] ^ rotateRight(t[(s0 >> 16) & 0xff], 8) ^ rotateRight(t[(s1 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s2 & 0xff], 24) ^ key[3];
+		s0 = t0;
+		s1 = t1;
+		s2 = t2;
+		s3 = t3;
+	}
+
+	// Last round without mix columns.
+	key += 4;
+	const uint8_t* sbox = kTables.sbox;
+	store(((static_cast<uint32_t>(sbox[s0 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s1 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s2 >> 8) & 0xff]) << 8) | sbox[s3 & 0xff]) ^
+			  key[0],
+		  &bufferOut[0]);
+	store(((static_cast<uint32_t>(sbox[s1 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s2 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s3 >> 8) & 0xff]) << 8) | sbox[s0 & 0xff]) ^
+			  key[1],
+		  &bufferOut[4]);
+	store(((static_cast<uint32_t>(sbox[s2 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s3 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s0 >> 8) & 0xff]) << 8) | sbox[s1 & 0xff]) ^
+			  key[2],
+		  &bufferOut[8]);
+	store(((static_cast<uint32_t>(sbox[s3 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s0 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s1 >> 8) & 0xff]) << 8) | sbox[s2 & 0xff]) ^
+			  key[3],
+		  &bufferOut[12]);
+}
+
+void AesSoftware::decryptBlock(const uint8_t dataIn[], uint8_t bufferOut[]) const
+{
+	const uint32_t* key = m_decryptKeys;
+	const uint32_t* t = kTables.decrypt;
+	uint32_t s0 = load(&dataIn[0]) ^ key[0];
+	uint32_t s1 = load(&dataIn[4]) ^ key[1];
+	uint32_t s2 = load(&dataIn[8]) ^ key[2];
+	uint32_t s3 = load(&dataIn[12]) ^ key[3];
+
+	for (size_t round = 1; round < m_rounds; round++)
+	{
+		key += 4;
+		uint32_t t0 = t[s0 >> 24] ^ rotateRight(t[(s3 >> 16) & 0xff], 8) ^ rotateRight(t[(s2 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s1 & 0xff], 24) ^ key[0];
+		uint32_t t1 = t[s1 >> 24] ^ rotateRight(t[(s0 >> 16) & 0xff], 8) ^ rotateRight(t[(s3 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s2 & 0xff], 24) ^ key[1];
+		uint32_t t2 = t[s2 >> 24] ^ rotateRight(t[(s1 >> 16) & 0xff], 8) ^ rotateRight(t[(s0 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s3 & 0xff], 24) ^ key[2];
+		uint32_t t3 = t[s3 >> 24] ^ rotateRight(t[(s2 >> 16) & 0xff], 8) ^ rotateRight(t[(s1 >> 8) & 0xff], 16) ^
+					  rotateRight(t[s0 & 0xff], 24) ^ key[3];
+		s0 = t0;
+		s1 = t1;
+		s2 = t2;
+		s3 = t3;
+	}
+
+	// Last round without inverse mix columns.
+	key += 4;
+	const uint8_t* sbox = kTables.inverseSbox;
+	store(((static_cast<uint32_t>(sbox[s0 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s3 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s2 >> 8) & 0xff]) << 8) | sbox[s1 & 0xff]) ^
+			  key[0],
+		  &bufferOut[0]);
+	store(((static_cast<uint32_t>(sbox[s1 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s0 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s3 >> 8) & 0xff]) << 8) | sbox[s2 & 0xff]) ^
+			  key[1],
+		  &bufferOut[4]);
+	store(((static_cast<uint32_t>(sbox[s2 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s1 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s0 >> 8) & 0xff]) << 8) | sbox[s3 & 0xff]) ^
+			  key[2],
+		  &bufferOut[8]);
+	store(((static_cast<uint32_t>(sbox[s3 >> 24]) << 24) | (static_cast<uint32_t>(sbox[(s2 >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(s1 >> 8) & 0xff]) << 8) | sbox[s0 & 0xff]) ^
+			  key[3],
+		  &bufferOut[12]);
+}
+
+uint32_t AesSoftware::rotateRight(uint32_t value, unsigned int count)
+{
+	return (value >> count) | (value << (32 - count));
+}
+
+uint32_t AesSoftware::substitute(uint32_t value)
+{
+	const uint8_t* sbox = kTables.sbox;
+	return (static_cast<uint32_t>(sbox[value >> 24]) << 24) | (static_cast<uint32_t>(sbox[(value >> 16) & 0xff]) << 16) |
+		   (static_cast<uint32_t>(sbox[(value >> 8) & 0xff]) << 8) | sbox[value & 0xff];
+}
+
+uint32_t AesSoftware::load(const uint8_t data[])
+{
+	return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) |
+		   static_cast<uint32_t>(data[3]);
+}
+
+void AesSoftware::store(uint32_t value, uint8_t data[])
+{
+	data[0] = static_cast<uint8_t>(value >> 24);
+	data[1] = static_cast<uint8_t>(value >> 16);
+	data[2] = static_cast<uint8_t>(value >> 8);
+	data[3] = static_cast<uint8_t>(value);
+}
+} /* namespace semf */
@@ -0,0 +1,121 @@
+/**
+ * @file aessoftware.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_AESSOFTWARE_H_
+#define SEMF_UTILS_PROCESSING_AESSOFTWARE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief AES (FIPS 197) block cipher in software.
+ *
+ * Encrypts and decrypts single 16 byte blocks and is used by the block cipher modes \c AesCbcSoftware and
+ * \c AesCtrSoftware. The round keys are expanded once in \c setKey(). Each round is calculated with four lookups
+ * into a 1 KiB table generated at compile time, the other three columns are rotations of the same table.
+ */
+class AesSoftware
+{
+public:
+	/**Size of a data block in bytes.*/
+	static constexpr size_t kBlockSize = 16;
+
+	AesSoftware() = default;
+	explicit AesSoftware(const AesSoftware& other) = delete;
+	virtual ~AesSoftware() = default;
+
+	/**
+	 * @brief Expands the key into the round keys for encryption and decryption.
+	 * @param key Pointer to the address of the key (as binary).
+	 * @param size Size of the key in bytes, 16, 24 or 32.
+	 * @return \c true for a valid key size, \c false otherwise.
+	 */
+	bool setKey(const uint8_t key[], size_t size);
+	/**
+	 * @brief Returns if a valid key was set.
+	 * @return \c true if a key is set, \c false otherwise.
+	 */
+	bool hasKey() const;
+	/**
+	 * @brief Encrypts one block.
+	 * @param dataIn Plain block.
+	 * @param bufferOut Encrypted block, can be the same as \c dataIn.
+	 */
+	void encryptBlock(const uint8_t dataIn[], uint8_t bufferOut[]) const;
+	/**
+	 * @brief Decrypts one block.
+	 * @param dataIn Encrypted block.
+	 * @param bufferOut Plain block, can be the same as \c dataIn.
+	 */
+	void decryptBlock(const uint8_t dataIn[], uint8_t bufferOut[]) const;
+
+private:
+	/**Lookup tables.*/
+	struct Tables
+	{
+		/**Substitution box.*/
+		uint8_t sbox[256];
+		/**Inverse substitution box.*/
+		uint8_t inverseSbox[256];
+		/**Substitution and mix columns for encryption rounds.*/
+		uint32_t encrypt[256];
+		/**Inverse substitution and inverse mix columns for decryption rounds.*/
+		uint32_t decrypt[256];
+	};
+	/**
+	 * @brief Generates the lookup tables.
+	 * @return Lookup tables.
+	 */
+	static constexpr Tables generateTables();
+	/**
+	 * @brief Multiplies two elements of GF(2^8) with the AES polynomial.
+	 * @param a First factor.
+	 * @param b Second factor.
+	 * @return Product.
+	 */
+	static constexpr uint8_t multiply(uint8_t a, uint8_t b);
+	/**
+	 * @brief Rotates a value to the right.
+	 * @param value Value to rotate.
+	 * @param count Number of bits to rotate, between 1 and 31.
+	 * @return Rotated value.
+	 */
+	static uint32_t rotateRight(uint32_t value, unsigned int count);
+	/**
+	 * @brief Substitutes every byte of a word with the substitution box.
+	 * @param value Word to substitute.
+	 * @return Substituted word.
+	 */
+	static uint32_t substitute(uint32_t value);
+	/**
+	 * @brief Reads a big endian word.
+	 * @param data Pointer to the first byte of the word.
+	 * @return Word.
+	 */
+	static uint32_t load(const uint8_t data[]);
+	/**
+	 * @brief Writes a big endian word.
+	 * @param value Word.
+	 * @param data Pointer to the first byte of the word.
+	 */
+	static void store(uint32_t value, uint8_t data[]);
+
+	/**Lookup tables generated at compile time.*/
+	static const Tables kTables;
+	/**Number of rounds, zero if no key is set.*/
+	size_t m_rounds = 0;
+	/**Round keys for encryption.*/
+	uint32_t m_encryptKeys[60];
+	/**Round keys for decryption in reverse order with inverse mix columns applied.*/
+	uint32_t m_decryptKeys[60];
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_AESSOFTWARE_H_ */
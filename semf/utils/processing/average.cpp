@@ -8,9 +8,15 @@
  */
 
 #include <semf/utils/processing/average.h>
+#include <type_traits>
 
 namespace semf
 {
+#ifdef __SIZEOF_INT128__
+/**Native 128 bit integer of GCC and Clang, \c __extension__ keeps \c -Wpedantic builds free of warnings.*/
+__extension__ typedef unsigned __int128 Uint128;
+#endif
+
 template <typename T>
 T Average<T>::value(const T data[], size_t dataSize)
 {
@@ -21,17 +27,49 @@ T Average<T>::value(const T data[], size_t dataSize)
 template <typename T>
 T Average<T>::value(const Buffer<T>& data)
 {
-	T sumLow = 0;
-	T sumLowLast = 0;
+	if (data.data() == nullptr)
+	{
+		return 0;
+	}
+
 	size_t sumHigh = 0;
-	size_t sumHighLast = 0;
-	size_t nValuesSummed = 0;
+	T sumLow = 0;
+	size_t nValuesSummed = sum(data, sumHigh, sumLow);
+	return divide(sumHigh, sumLow, nValuesSummed);
+}
 
+template <typename T>
+T Average<T>::value(const T data[], size_t dataSize, const IntegerDivider& divider)
+{
+	const Buffer<T> buffer(const_cast<T*>(data), dataSize);
+	return value(buffer, divider);
+}
+
+template <typename T>
+T Average<T>::value(const Buffer<T>& data, const IntegerDivider& divider)
+{
 	if (data.data() == nullptr)
 	{
 		return 0;
 	}
 
+	size_t sumHigh = 0;
+	T sumLow = 0;
+	size_t nValuesSummed = sum(data, sumHigh, sumLow);
+
+	uint64_t joined;
+	if (nValuesSummed == divider.divisor() && join(sumHigh, sumLow, joined))
+		return static_cast<T>(divider.divide(joined));
+	return divide(sumHigh, sumLow, nValuesSummed);
+}
+
+template <typename T>
+size_t Average<T>::sum(const Buffer<T>& data, size_t& sumHigh, T& sumLow)
+{
+	T sumLowLast = 0;
+	size_t sumHighLast = 0;
+	size_t nValuesSummed = 0;
+
 	// summing up the values
 	for (size_t i = 0; i < data.count(); i++)
 	{
@@ -52,12 +90,43 @@ T Average<T>::value(const Buffer<T>& data)
 		sumHighLast = sumHigh;
 		nValuesSummed++;
 	}
+	return nValuesSummed;
+}
 
-	return divide(sumHigh, sumLow, nValuesSummed);
+template <typename T>
+bool Average<T>::join(size_t highValue, T lowValue, uint64_t& joined)
+{
+	typedef typename std::make_unsigned<T>::type Unsigned;
+	uint64_t high = static_cast<uint64_t>(highValue);
+	if ((high >> (64 - kLowBits)) != 0)
+		return false;
+
+	// for 64 bit types the high part is zero here, the modulo only keeps the shift count valid
+	joined = (high << (kLowBits % 64)) | static_cast<Unsigned>(lowValue);
+	return true;
 }
 
 template <typename T>
 T Average<T>::divide(size_t highValue, T lowValue, size_t divider)
+{
+	if (divider == 0)
+		return divideBitwise(highValue, lowValue, divider);
+
+	uint64_t joined;
+	if (join(highValue, lowValue, joined))
+		return static_cast<T>(joined / divider);
+
+#ifdef __SIZEOF_INT128__
+	typedef typename std::make_unsigned<T>::type Unsigned;
+	Uint128 wide = (static_cast<Uint128>(highValue) << kLowBits) | static_cast<Unsigned>(lowValue);
+	return static_cast<T>(static_cast<Unsigned>(wide / divider));
+#else
+	return divideBitwise(highValue, lowValue, divider);
+#endif
+}
+
+template <typename T>
+T Average<T>::divideBitwise(size_t highValue, T lowValue, size_t divider)
 {
 	uint32_t binPlacesDivider = 0;  // for counting the binary places of the divider
 	T mask = 0;
@@ -11,6 +11,7 @@
 #define SEMF_UTILS_PROCESSING_AVERAGE_H_
 
 #include <semf/utils/core/buffer/buffer.h>
+#include <semf/utils/processing/integerdivider.h>
 
 namespace semf
 {
@@ -18,6 +19,9 @@ namespace semf
  * @brief \c Average calculates the average value of the entries of
  * a given \c Buffer or an data array. The types uint8_t, int8_t, uint16_t,
  * int16_t, uint32_t, int32_t, uint64_t and int64_t are supported.
+ *
+ * For a fixed number of values, e.g. the window size of a filter, an \c IntegerDivider with this number can be
+ * passed, which replaces the division through a multiplication.
  * @tparam Data type.
  */
 template <typename T>
@@ -39,16 +43,65 @@ public:
 	 */
 	static T value(const Buffer<T>& data);
 
+	/**
+	 * @brief Calculates an average out of an array with a precomputed divider.
+	 * @note If the number of summed values does not match the divisor, the sum is divided through the number.
+	 * @param data Pointer to the data array.
+	 * @param dataSize Size of data array.
+	 * @param divider Divider with the expected number of values as divisor.
+	 * @return Average.
+	 */
+	static T value(const T data[], size_t dataSize, const IntegerDivider& divider);
+
+	/**
+	 * @brief Calculates an average over the content of a buffer with a precomputed divider.
+	 * @note If the number of summed values does not match the divisor, the sum is divided through the number.
+	 * @param data Buffer to calculate the average over.
+	 * @param divider Divider with the expected number of values as divisor.
+	 * @return Average.
+	 */
+	static T value(const Buffer<T>& data, const IntegerDivider& divider);
+
 private:
+	/**Number of bits of the low part of a sum.*/
+	static constexpr unsigned int kLowBits = sizeof(T) * 8;
+
+	/**
+	 * @brief Sums up the content of a buffer.
+	 * @note The summing stops before the high part would overflow.
+	 * @param data Buffer to sum up.
+	 * @param sumHigh Returns the high part of the sum.
+	 * @param sumLow Returns the low part of the sum.
+	 * @return Number of values summed.
+	 */
+	static size_t sum(const Buffer<T>& data, size_t& sumHigh, T& sumLow);
+	/**
+	 * @brief Joins a sum to a 64 bit number.
+	 * @param highValue High part of the sum.
+	 * @param lowValue Low part of the sum.
+	 * @param joined Returns the joined sum.
+	 * @return \c true if the sum fits into 64 bit, \c false otherwise.
+	 */
+	static bool join(size_t highValue, T lowValue, uint64_t& joined);
 	/**
 	 * @brief Builds the average by dividing a sum through a divider.
 	 * @note average = [highValue lowValue] / divider
+	 * @note The native 64 bit (or 128 bit, if available) division is used, if the sum fits into it.
 	 * @param highValue High part of the sum to divide.
 	 * @param lowValue Low part of the sum to divide.
 	 * @param divider Number to divide the sum with.
 	 * @return Average.
 	 */
 	static T divide(size_t highValue, T lowValue, size_t divider);
+	/**
+	 * @brief Builds the average bit by bit by dividing a sum through a divider.
+	 * @note average = [highValue lowValue] / divider
+	 * @param highValue High part of the sum to divide.
+	 * @param lowValue Low part of the sum to divide.
+	 * @param divider Number to divide the sum with.
+	 * @return Average.
+	 */
+	static T divideBitwise(size_t highValue, T lowValue, size_t divider);
 };
 
 /**Average for unsigned 8 bit.*/
@@ -0,0 +1,69 @@
+/**
+ * @file bitreader.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/processing/bitreader.h>
+#include <semf/utils/processing/bitsetutility.h>
+
+namespace semf
+{
+BitReader::BitReader(const uint8_t data[], size_t dataSize)
+: m_data(data),
+  m_dataSize(dataSize)
+{
+}
+
+uint64_t BitReader::read(uint8_t bits)
+{
+	if (bits > 64)
+		bits = 64;
+	if (bits > remaining())
+		m_overrun = true;
+
+	uint64_t value = BitsetUtility::readBits(m_data, m_dataSize, m_position, bits);
+	m_position += bits;
+	return value;
+}
+
+bool BitReader::readBool()
+{
+	return read(1) != 0;
+}
+
+void BitReader::skip(size_t bits)
+{
+	if (bits > remaining())
+		m_overrun = true;
+	m_position += bits;
+}
+
+void BitReader::alignToByte()
+{
+	m_position = (m_position + 7) / 8 * 8;
+}
+
+void BitReader::setPosition(size_t position)
+{
+	m_position = position;
+}
+
+size_t BitReader::position() const
+{
+	return m_position;
+}
+
+size_t BitReader::remaining() const
+{
+	return m_position < m_dataSize * 8 ? m_dataSize * 8 - m_position : 0;
+}
+
+bool BitReader::isOverrun() const
+{
+	return m_overrun;
+}
+} /* namespace semf */
@@ -0,0 +1,86 @@
+/**
+ * @file bitreader.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_BITREADER_H_
+#define SEMF_UTILS_PROCESSING_BITREADER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief \c BitReader reads fields of variable bit width one after another from an array.
+ *
+ * The bits are numbered like in \c BitsetUtility, so the first field starts at the least significant bit
+ * of the first byte. Reading behind the end of the array returns zero bits and sets the overrun flag.
+ */
+class BitReader
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param data The array to read from.
+	 * @param dataSize The size of the array.
+	 */
+	BitReader(const uint8_t data[], size_t dataSize);
+	explicit BitReader(const BitReader& other) = delete;
+	virtual ~BitReader() = default;
+
+	/**
+	 * @brief Reads the next field.
+	 * @param bits Width of the field, at most 64.
+	 * @return Value of the field.
+	 */
+	uint64_t read(uint8_t bits);
+	/**
+	 * @brief Reads the next bit.
+	 * @return \c true if the bit is set.
+	 */
+	bool readBool();
+	/**
+	 * @brief Skips bits.
+	 * @param bits Number of bits to skip.
+	 */
+	void skip(size_t bits);
+	/**Moves the position to the beginning of the next byte, if it is not at the beginning of a byte already.*/
+	void alignToByte();
+	/**
+	 * @brief Sets the position of the next bit to read.
+	 * @param position Bit position.
+	 */
+	void setPosition(size_t position);
+	/**
+	 * @brief Returns the position of the next bit to read.
+	 * @return Bit position.
+	 */
+	size_t position() const;
+	/**
+	 * @brief Returns the number of bits left in the array.
+	 * @return Number of bits.
+	 */
+	size_t remaining() const;
+	/**
+	 * @brief Returns if bits behind the end of the array were read.
+	 * @return \c true on overrun.
+	 */
+	bool isOverrun() const;
+
+private:
+	/**Array to read from.*/
+	const uint8_t* m_data;
+	/**Size of the array.*/
+	size_t m_dataSize;
+	/**Position of the next bit.*/
+	size_t m_position = 0;
+	/**Flag for bits read behind the end of the array.*/
+	bool m_overrun = false;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_BITREADER_H_ */
@@ -10,6 +10,7 @@
 #ifndef SEMF_UTILS_PROCESSING_BITSETUTILITY_H_
 #define SEMF_UTILS_PROCESSING_BITSETUTILITY_H_
 
+#include <semf/utils/processing/endian/endian.h>
 #include <cstdint>
 #include <bitset>
 
@@ -17,6 +18,9 @@ namespace semf
 {
 /**
  * @brief Useful helper functions for handeling bitsets.
+ *
+ * Bits are numbered from the least significant bit of the first byte on, so bit 8 is the least significant bit of
+ * the second byte. Bits are moved in chunks of up to 64 bit by loading and storing unaligned 8 byte windows.
  * @note They are used in ecc classes.
  */
 class BitsetUtility
@@ -53,6 +57,44 @@ public:
 	 */
 	template <size_t N>
 	static size_t insertBitsetInBuffer(std::bitset<N> bitset, uint8_t buffer[], size_t bufferSize, size_t firstBit);
+
+	/**
+	 * @brief Reads up to 64 bits from an array.
+	 * @param data The array with the data.
+	 * @param dataSize The size of the data.
+	 * @param firstBit The first bit to be read.
+	 * @param count Number of bits to read, at most 64.
+	 * @return The bits, the first bit is the least significant one. Bits behind the array are zero.
+	 */
+	static uint64_t readBits(const uint8_t data[], size_t dataSize, size_t firstBit, uint8_t count);
+
+	/**
+	 * @brief Writes up to 64 bits into an array, the other bits of the array are not changed.
+	 * @param value The bits to write, the least significant one is written first.
+	 * @param buffer The array in which the bits are stored.
+	 * @param bufferSize The size of the buffer.
+	 * @param firstBit The position in which the bits are stored in the array.
+	 * @param count Number of bits to write, at most 64.
+	 * @return The number of bits written into the array.
+	 */
+	static size_t writeBits(uint64_t value, uint8_t buffer[], size_t bufferSize, size_t firstBit, uint8_t count);
+
+private:
+	/**
+	 * @brief Loads up to 8 bytes as little-endian number.
+	 * @param data Address of the first byte.
+	 * @param available Number of bytes available from \c data on.
+	 * @return Loaded bytes, missing bytes are zero.
+	 */
+	static uint64_t loadWindow(const uint8_t data[], size_t available);
+
+	/**
+	 * @brief Stores up to 8 bytes of a little-endian number.
+	 * @param data Address of the first byte.
+	 * @param available Number of bytes available from \c data on.
+	 * @param window Bytes to store.
+	 */
+	static void storeWindow(uint8_t data[], size_t available, uint64_t window);
 };
 
 template <size_t N>
@@ -66,29 +108,98 @@ std::bitset<N> BitsetUtility::createBitset(const uint8_t data[], size_t dataSize
 {
 	std::bitset<N> bitset;
 
-	for (size_t i = 0; (i < N) && (((firstBit + i) / 8) < dataSize); i++)
+	for (size_t i = 0; i < N; i += 64)
 	{
-		bitset.set(i, data[(firstBit + i) / 8] & (1 << ((firstBit + i) % 8)));
+		uint8_t count = static_cast<uint8_t>(N - i < 64 ? N - i : 64);
+		uint64_t chunk = readBits(data, dataSize, firstBit + i, count);
+		if (N <= 64)
+			bitset = std::bitset<N>(chunk);
+		else
+			bitset |= std::bitset<N>(chunk) << i;
 	}
 
 	return bitset;
 }
 
 template <size_t N>
-static size_t insertBitsetInBuffer(std::bitset<N> bitset, uint8_t buffer[], size_t bufferSize, size_t firstBit)
+size_t BitsetUtility::insertBitsetInBuffer(std::bitset<N> bitset, uint8_t buffer[], size_t bufferSize, size_t firstBit)
 {
-	size_t i = 0;
+	size_t written = 0;
 
-	for (; (i < N) && (((firstBit + i) / 8) < bufferSize); i++)
+	for (size_t i = 0; i < N; i += 64)
 	{
-		if (bitset[i])
-			buffer[(firstBit + i) / 8] |= static_cast<uint8_t>((1 << ((firstBit + i) % 8)));
-
+		uint8_t count = static_cast<uint8_t>(N - i < 64 ? N - i : 64);
+		uint64_t chunk;
+		if (N <= 64)
+			chunk = bitset.to_ullong();
 		else
-			buffer[(firstBit + i) / 8] &= static_cast<uint8_t>(~(1 << ((firstBit + i) % 8)));
+			chunk = ((bitset >> i) & std::bitset<N>(UINT64_MAX)).to_ullong();
+		written += writeBits(chunk, buffer, bufferSize, firstBit + i, count);
+	}
+
+	return written;
+}
+
+inline uint64_t BitsetUtility::readBits(const uint8_t data[], size_t dataSize, size_t firstBit, uint8_t count)
+{
+	size_t byte = firstBit / 8;
+	uint8_t shift = firstBit % 8;
+	if (byte >= dataSize || count == 0)
+		return 0;
+
+	uint64_t value = loadWindow(data + byte, dataSize - byte) >> shift;
+	// a window of 8 bytes holds only 64 - shift bits, the rest is in the ninth byte
+	if (shift + count > 64 && byte + 8 < dataSize)
+		value |= static_cast<uint64_t>(data[byte + 8]) << (64 - shift);
+	if (count < 64)
+		value &= (static_cast<uint64_t>(1) << count) - 1;
+	return value;
+}
+
+inline size_t BitsetUtility::writeBits(uint64_t value, uint8_t buffer[], size_t bufferSize, size_t firstBit, uint8_t count)
+{
+	size_t byte = firstBit / 8;
+	uint8_t shift = firstBit % 8;
+	if (byte >= bufferSize || count == 0)
+		return 0;
+
+	uint64_t mask = count < 64 ? (static_cast<uint64_t>(1) << count) - 1 : UINT64_MAX;
+	value &= mask;
+	size_t available = bufferSize - byte;
+	uint64_t window = loadWindow(buffer + byte, available);
+	window = (window & ~(mask << shift)) | (value << shift);
+	storeWindow(buffer + byte, available, window);
+	if (shift + count > 64 && byte + 8 < bufferSize)
+	{
+		uint8_t highMask = static_cast<uint8_t>(mask >> (64 - shift));
+		buffer[byte + 8] = static_cast<uint8_t>((buffer[byte + 8] & ~highMask) | (value >> (64 - shift)));
+	}
+
+	size_t bitsAvailable = bufferSize * 8 - firstBit;
+	return count < bitsAvailable ? count : bitsAvailable;
+}
+
+inline uint64_t BitsetUtility::loadWindow(const uint8_t data[], size_t available)
+{
+	if (available >= 8)
+		return Endian::fromLittleEndian<uint64_t>(data);
+
+	uint64_t window = 0;
+	for (size_t i = 0; i < available; i++)
+		window |= static_cast<uint64_t>(data[i]) << (i * 8);
+	return window;
+}
+
+inline void BitsetUtility::storeWindow(uint8_t data[], size_t available, uint64_t window)
+{
+	if (available >= 8)
+	{
+		Endian::toLittleEndian<uint64_t>(window, data);
+		return;
 	}
 
-	return i;
+	for (size_t i = 0; i < available; i++)
+		data[i] = static_cast<uint8_t>(window >> (i * 8));
 }
 } /* namespace semf */
 #endif  // SEMF_UTILS_PROCESSING_BITSETUTILITY_H_
@@ -0,0 +1,74 @@
+/**
+ * @file bitwriter.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/processing/bitwriter.h>
+#include <semf/utils/processing/bitsetutility.h>
+
+namespace semf
+{
+BitWriter::BitWriter(uint8_t buffer[], size_t bufferSize)
+: m_buffer(buffer),
+  m_bufferSize(bufferSize)
+{
+}
+
+void BitWriter::write(uint64_t value, uint8_t bits)
+{
+	if (bits > 64)
+		bits = 64;
+	if (bits > remaining())
+		m_overrun = true;
+
+	BitsetUtility::writeBits(value, m_buffer, m_bufferSize, m_position, bits);
+	m_position += bits;
+}
+
+void BitWriter::writeBool(bool value)
+{
+	write(value ? 1 : 0, 1);
+}
+
+void BitWriter::skip(size_t bits)
+{
+	if (bits > remaining())
+		m_overrun = true;
+	m_position += bits;
+}
+
+void BitWriter::alignToByte()
+{
+	m_position = (m_position + 7) / 8 * 8;
+}
+
+void BitWriter::setPosition(size_t position)
+{
+	m_position = position;
+}
+
+size_t BitWriter::position() const
+{
+	return m_position;
+}
+
+size_t BitWriter::size() const
+{
+	size_t bytes = (m_position + 7) / 8;
+	return bytes < m_bufferSize ? bytes : m_bufferSize;
+}
+
+size_t BitWriter::remaining() const
+{
+	return m_position < m_bufferSize * 8 ? m_bufferSize * 8 - m_position : 0;
+}
+
+bool BitWriter::isOverrun() const
+{
+	return m_overrun;
+}
+} /* namespace semf */
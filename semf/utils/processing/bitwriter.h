@@ -0,0 +1,92 @@
+/**
+ * @file bitwriter.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_BITWRITER_H_
+#define SEMF_UTILS_PROCESSING_BITWRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief \c BitWriter writes fields of variable bit width one after another into an array.
+ *
+ * The bits are numbered like in \c BitsetUtility, so the first field starts at the least significant bit
+ * of the first byte. Bits of the array, which are skipped, are not changed. Bits behind the end of the array
+ * are dropped and set the overrun flag.
+ */
+class BitWriter
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param buffer The array to write into.
+	 * @param bufferSize The size of the array.
+	 */
+	BitWriter(uint8_t buffer[], size_t bufferSize);
+	explicit BitWriter(const BitWriter& other) = delete;
+	virtual ~BitWriter() = default;
+
+	/**
+	 * @brief Writes the next field.
+	 * @param value Value of the field, bits above the width are ignored.
+	 * @param bits Width of the field, at most 64.
+	 */
+	void write(uint64_t value, uint8_t bits);
+	/**
+	 * @brief Writes the next bit.
+	 * @param value \c true for setting the bit.
+	 */
+	void writeBool(bool value);
+	/**
+	 * @brief Skips bits.
+	 * @param bits Number of bits to skip.
+	 */
+	void skip(size_t bits);
+	/**Moves the position to the beginning of the next byte, if it is not at the beginning of a byte already.*/
+	void alignToByte();
+	/**
+	 * @brief Sets the position of the next bit to write.
+	 * @param position Bit position.
+	 */
+	void setPosition(size_t position);
+	/**
+	 * @brief Returns the position of the next bit to write.
+	 * @return Bit position.
+	 */
+	size_t position() const;
+	/**
+	 * @brief Returns the number of bytes containing written bits.
+	 * @return Number of bytes up to the current position.
+	 */
+	size_t size() const;
+	/**
+	 * @brief Returns the number of bits left in the array.
+	 * @return Number of bits.
+	 */
+	size_t remaining() const;
+	/**
+	 * @brief Returns if bits behind the end of the array were written.
+	 * @return \c true on overrun.
+	 */
+	bool isOverrun() const;
+
+private:
+	/**Array to write into.*/
+	uint8_t* m_buffer;
+	/**Size of the array.*/
+	size_t m_bufferSize;
+	/**Position of the next bit.*/
+	size_t m_position = 0;
+	/**Flag for bits written behind the end of the array.*/
+	bool m_overrun = false;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_BITWRITER_H_ */
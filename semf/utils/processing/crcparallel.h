@@ -0,0 +1,170 @@
+/**
+ * @file crcparallel.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_CRCPARALLEL_H_
+#define SEMF_UTILS_PROCESSING_CRCPARALLEL_H_
+
+#include <semf/app/processing/crc.h>
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/crcsoftware.h>
+#include <semf/utils/processing/crcsoftwaretable.h>
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace semf
+{
+/**
+ * @brief Template class for CRC generation on multiple threads for host tools.
+ *
+ * The data is split into one segment per thread. Every thread calculates the CRC of its segment with
+ * \c CrcSoftwareTable and the segment CRC values are merged with \c CrcSoftware::combine, so the result is the
+ * same as calculating the data sequentially with \c CrcSoftware.
+ *
+ * @note Requires \c std::thread, so it is only usable on host builds.
+ * @param T CRC data type
+ * @param POLYNOMIAL CRC polynomial.
+ * @param DEFAULT_INITVALUE CRC default init value.
+ * @param DEFAULT_FINALXOR CRC default final xor.
+ */
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+class CrcParallel : public app::Crc
+{
+public:
+	/**Minimal segment size in bytes, smaller data is not split to keep the thread overhead low.*/
+	static constexpr size_t kMinSegmentSize = 64 * 1024;
+	/**Number of bytes the segment CRC processes at once, at least the size of \c T as needed by \c CrcSoftwareTable.*/
+	static constexpr size_t kSlices = sizeof(T) > 4 ? sizeof(T) : 4;
+
+	/**
+	 * @brief Constructor.
+	 * @param threadCount Number of threads, zero uses the number of hardware threads.
+	 * @param initValue Uses this initValue instead of the default initValue.
+	 * @param finalXor Uses this final xor value instead of the default final xor value.
+	 */
+	explicit CrcParallel(size_t threadCount = 0, T initValue = DEFAULT_INITVALUE, T finalXor = DEFAULT_FINALXOR);
+	explicit CrcParallel(const CrcParallel& other) = delete;
+	virtual ~CrcParallel() = default;
+
+	void reset() override;
+	const uint8_t* accumulate(const uint8_t data[], size_t dataSize) override;
+	const uint8_t* calculate(const uint8_t data[], size_t dataSize) override;
+	bool isEqual(const uint8_t data[]) override;
+	size_t bitSize() const override;
+	size_t byteSize() const override;
+
+private:
+	/**Number of threads.*/
+	size_t m_threadCount;
+	/** Initialization value.*/
+	const T m_initValue;
+	/** Final xor value.*/
+	const T m_finalXor;
+	/**Bitwise CRC object for combining the segment CRC values.*/
+	CrcSoftware<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR> m_combiner;
+	/** CRC value for accumulate.*/
+	T m_crc;
+};
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::CrcParallel(size_t threadCount, T initValue, T finalXor)
+: m_threadCount(threadCount),
+  m_initValue(initValue),
+  m_finalXor(finalXor),
+  m_combiner(POLYNOMIAL, initValue, finalXor),
+  m_crc(initValue ^ m_finalXor)
+{
+	if (m_threadCount == 0)
+		m_threadCount = std::thread::hardware_concurrency();
+	if (m_threadCount == 0)
+		m_threadCount = 1;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+void CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::reset()
+{
+	SEMF_INFO("reset");
+	m_crc = m_initValue ^ m_finalXor;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+const uint8_t* CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::accumulate(const uint8_t data[], size_t dataSize)
+{
+	size_t segmentCount = dataSize / kMinSegmentSize;
+	if (segmentCount > m_threadCount)
+		segmentCount = m_threadCount;
+	if (segmentCount == 0)
+		segmentCount = 1;
+
+	size_t segmentSize = dataSize / segmentCount;
+	std::vector<T> crcs(segmentCount);
+	std::vector<std::thread> threads;
+	threads.reserve(segmentCount - 1);
+	auto calculateSegment = [&](size_t segment) {
+		size_t begin = segment * segmentSize;
+		size_t size = segment + 1 == segmentCount ? dataSize - begin : segmentSize;
+		CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, kSlices> crc(m_initValue, m_finalXor);
+		std::memcpy(&crcs[segment], crc.calculate(&data[begin], size), sizeof(T));
+	};
+	// The calling thread calculates the last segment itself.
+	for (size_t segment = 0; segment + 1 < segmentCount; segment++)
+		threads.emplace_back(calculateSegment, segment);
+	calculateSegment(segmentCount - 1);
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (size_t segment = 0; segment < segmentCount; segment++)
+	{
+		size_t size = segment + 1 == segmentCount ? dataSize - segment * segmentSize : segmentSize;
+		m_crc = m_combiner.combine(m_crc, crcs[segment], size);
+	}
+	SEMF_INFO("accumulated with data %p and size %u on %u threads to crc value %u", data, dataSize, segmentCount, m_crc);
+	return reinterpret_cast<const uint8_t*>(&m_crc);
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+const uint8_t* CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::calculate(const uint8_t data[], size_t dataSize)
+{
+	m_crc = m_initValue ^ m_finalXor;
+	accumulate(data, dataSize);
+	SEMF_INFO("calculated with data %p and size %u to crc value %u", data, dataSize, m_crc);
+	return reinterpret_cast<const uint8_t*>(&m_crc);
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+bool CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::isEqual(const uint8_t data[])
+{
+	if (data == nullptr)
+	{
+		SEMF_ERROR("input is nullptr");
+		return false;
+	}
+	bool e = std::memcmp(reinterpret_cast<const uint8_t*>(&m_crc), data, sizeof(T)) == 0;
+	SEMF_INFO("crc equal: %d", e);
+	return e;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+size_t CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::bitSize() const
+{
+	return sizeof(T) * 8;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+size_t CrcParallel<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::byteSize() const
+{
+	size_t ret = bitSize() / 8;
+	return (bitSize() % 8 == 0) ? ret : ret + 1;
+}
+
+/** Typedef for parallel Crc32 calculation*/
+typedef CrcParallel<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF> Crc32Parallel;
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_CRCPARALLEL_H_ */
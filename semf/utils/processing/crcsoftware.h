@@ -45,8 +45,33 @@ public:
 	bool isEqual(const uint8_t data[]) override;
 	size_t bitSize() const override;
 	size_t byteSize() const override;
+	/**
+	 * @brief Combines the CRC values of two consecutive data blocks to the CRC value of the whole data.
+	 *
+	 * Both CRC values have to be calculated with the polynomial, init value and final xor value of this object.
+	 * The effect of \c lengthB zero bytes on \c crcA is calculated by squaring a GF(2) matrix for every bit of
+	 * \c lengthB, so the costs only grow logarithmically with the length.
+	 * @param crcA CRC value of the first data block.
+	 * @param crcB CRC value of the second data block.
+	 * @param lengthB Size of the second data block in bytes.
+	 * @return CRC value of the first data block followed by the second data block.
+	 */
+	T combine(T crcA, T crcB, size_t lengthB) const;
 
 private:
+	/**
+	 * @brief Multiplies a GF(2) matrix with a vector.
+	 * @param matrix Matrix with one column per bit of \c T.
+	 * @param vector Vector to multiply.
+	 * @return Product.
+	 */
+	static T gf2MatrixTimes(const T matrix[], T vector);
+	/**
+	 * @brief Squares a GF(2) matrix.
+	 * @param square Matrix to store the product in.
+	 * @param matrix Matrix to square.
+	 */
+	static void gf2MatrixSquare(T square[], const T matrix[]);
 	/**
 	 * @brief Inverts the bit sequence of the CRC polynomial.
 	 * @param value The value at which the bit sequence is to be invert.
@@ -133,13 +158,71 @@ size_t CrcSoftware<T, DEFAULT_POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::
 	return (bitSize() % 8 == 0) ? ret : ret + 1;
 }
 
+template <typename T, T DEFAULT_POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+T CrcSoftware<T, DEFAULT_POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::combine(T crcA, T crcB, size_t lengthB) const
+{
+	if (lengthB == 0)
+		return crcA;
+
+	constexpr size_t bits = sizeof(T) * 8;
+	T even[bits];
+	T odd[bits];
+
+	// Operator for one zero bit.
+	odd[0] = m_invertedPolynomial;
+	for (size_t i = 1; i < bits; i++)
+		odd[i] = static_cast<T>(1) << (i - 1);
+	// Operators for two and four zero bits.
+	gf2MatrixSquare(even, odd);
+	gf2MatrixSquare(odd, even);
+
+	// Without final xor and init value, crcA is only a linear function of the data, which can be shifted by
+	// zero bytes independently from crcB.
+	T crc = crcA ^ m_finalXor ^ m_initValue;
+	do
+	{
+		gf2MatrixSquare(even, odd);
+		if (lengthB & 1)
+			crc = gf2MatrixTimes(even, crc);
+		lengthB >>= 1;
+		if (lengthB == 0)
+			break;
+
+		gf2MatrixSquare(odd, even);
+		if (lengthB & 1)
+			crc = gf2MatrixTimes(odd, crc);
+		lengthB >>= 1;
+	} while (lengthB != 0);
+
+	return crc ^ crcB;
+}
+
+template <typename T, T DEFAULT_POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+T CrcSoftware<T, DEFAULT_POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::gf2MatrixTimes(const T matrix[], T vector)
+{
+	T sum = 0;
+	for (size_t i = 0; vector != 0; i++, vector >>= 1)
+	{
+		if (vector & 1)
+			sum ^= matrix[i];
+	}
+	return sum;
+}
+
+template <typename T, T DEFAULT_POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
+void CrcSoftware<T, DEFAULT_POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::gf2MatrixSquare(T square[], const T matrix[])
+{
+	for (size_t i = 0; i < sizeof(T) * 8; i++)
+		square[i] = gf2MatrixTimes(matrix, matrix[i]);
+}
+
 template <typename T, T DEFAULT_POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR>
 T CrcSoftware<T, DEFAULT_POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR>::invertBitSequence(T value)
 {
 	T retVal = 0;
 	for (size_t i = 0; i < sizeof(T) * 8; i++)
 	{
-		retVal |= (((1 << i) & value) ? 1u : 0u) << (sizeof(T) * 8 - 1 - i);
+		retVal |= static_cast<T>(((static_cast<T>(1) << i) & value) ? 1u : 0u) << (sizeof(T) * 8 - 1 - i);
 	}
 
 	return retVal;
@@ -0,0 +1,215 @@
+/**
+ * @file crcsoftwaretable.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_CRCSOFTWARETABLE_H_
+#define SEMF_UTILS_PROCESSING_CRCSOFTWARETABLE_H_
+
+#include <semf/app/processing/crc.h>
+#include <semf/utils/core/debug.h>
+#include <cstring>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Template class for table driven CRC generation in software.
+ *
+ * Calculates the same CRC values as \c CrcSoftware with the same template parameters, but processes a whole byte
+ * with one table lookup instead of eight shift and xor steps. The tables are generated at compile time from the
+ * polynomial and are stored in flash memory.
+ *
+ * With \c SLICES bigger than one, \c SLICES bytes are processed at once by using one table per byte (slicing by N).
+ * Every table needs 256 * sizeof(T) bytes, e.g. \c Crc32SoftwareTable with slicing by eight needs 8 KiB.
+ *
+ * @param T CRC data type
+ * @param POLYNOMIAL CRC polynomial.
+ * @param DEFAULT_INITVALUE CRC default init value.
+ * @param DEFAULT_FINALXOR CRC default final xor.
+ * @param SLICES Number of bytes processed at once, one or at least the size of \c T.
+ */
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES = 1>
+class CrcSoftwareTable : public app::Crc
+{
+	static_assert(SLICES == 1 || (SLICES >= sizeof(T) && SLICES <= 16), "SLICES has to be one or between the size of T and 16");
+
+public:
+	/**
+	 * @brief Constructor.
+	 * @param initValue Uses this initValue instead of the default initValue.
+	 * @param finalXor Uses this final xor value instead of the default final xor value.
+	 */
+	explicit CrcSoftwareTable(T initValue = DEFAULT_INITVALUE, T finalXor = DEFAULT_FINALXOR);
+	explicit CrcSoftwareTable(const CrcSoftwareTable& other) = delete;
+	virtual ~CrcSoftwareTable() = default;
+
+	void reset() override;
+	const uint8_t* accumulate(const uint8_t data[], size_t dataSize) override;
+	const uint8_t* calculate(const uint8_t data[], size_t dataSize) override;
+	bool isEqual(const uint8_t data[]) override;
+	size_t bitSize() const override;
+	size_t byteSize() const override;
+
+private:
+	/**Lookup tables, table \c n holds the CRC of each byte followed by \c n zero bytes.*/
+	struct Table
+	{
+		/**Table entries.*/
+		T entries[SLICES][256];
+	};
+	/**
+	 * @brief Inverts the bit sequence of the CRC polynomial.
+	 * @param value The value at which the bit sequence is to be invert.
+	 * @return The value with the inverted bit sequence.
+	 */
+	static constexpr T invertBitSequence(T value);
+	/**
+	 * @brief Generates the lookup tables for the inverted polynomial.
+	 * @return Lookup tables.
+	 */
+	static constexpr Table generateTable();
+	/**Lookup tables generated at compile time.*/
+	static constexpr Table kTable = generateTable();
+	/** Initialization value.*/
+	const T m_initValue;
+	/** Final xor value.*/
+	const T m_finalXor;
+	/** CRC value for accumulate.*/
+	T m_crc;
+};
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::CrcSoftwareTable(T initValue, T finalXor)
+: m_initValue(initValue),
+  m_finalXor(finalXor),
+  m_crc(initValue ^ m_finalXor)
+{
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+void CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::reset()
+{
+	SEMF_INFO("reset");
+	m_crc = m_initValue ^ m_finalXor;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+const uint8_t* CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::accumulate(const uint8_t data[], size_t dataSize)
+{
+	T crc = m_crc ^ m_finalXor;
+	size_t i = 0;
+	if (SLICES > 1)
+	{
+		for (; i + SLICES <= dataSize; i += SLICES)
+		{
+			T next = 0;
+			for (size_t j = 0; j < SLICES; j++)
+			{
+				uint8_t index = data[i + j];
+				if (j < sizeof(T))
+					index ^= static_cast<uint8_t>(crc >> (j * 8));
+				next ^= kTable.entries[SLICES - 1 - j][index];
+			}
+			crc = next;
+		}
+	}
+	for (; i < dataSize; i++)
+	{
+		// Shifting in two steps, because shifting an 8 bit CRC by eight is not defined for all integer promotions.
+		crc = static_cast<T>((crc >> 4) >> 4) ^ kTable.entries[0][static_cast<uint8_t>(crc ^ data[i])];
+	}
+	m_crc = crc ^ m_finalXor;
+	SEMF_INFO("accumulated with data %p and size %u to crc value %u", data, dataSize, m_crc);
+	return reinterpret_cast<const uint8_t*>(&m_crc);
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+const uint8_t* CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::calculate(const uint8_t data[], size_t dataSize)
+{
+	m_crc = m_initValue ^ m_finalXor;
+	accumulate(data, dataSize);
+	SEMF_INFO("calculated with data %p and size %u to crc value %u", data, dataSize, m_crc);
+	return reinterpret_cast<const uint8_t*>(&m_crc);
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+bool CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::isEqual(const uint8_t data[])
+{
+	if (data == nullptr)
+	{
+		SEMF_ERROR("input is nullptr");
+		return false;
+	}
+	bool e = std::memcmp(reinterpret_cast<const uint8_t*>(&m_crc), data, sizeof(T)) == 0;
+	SEMF_INFO("crc equal: %d", e);
+	return e;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+size_t CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::bitSize() const
+{
+	return sizeof(T) * 8;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+size_t CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::byteSize() const
+{
+	size_t ret = bitSize() / 8;
+	return (bitSize() % 8 == 0) ? ret : ret + 1;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+constexpr T CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::invertBitSequence(T value)
+{
+	T retVal = 0;
+	for (size_t i = 0; i < sizeof(T) * 8; i++)
+	{
+		if (value & (static_cast<T>(1) << i))
+			retVal |= static_cast<T>(1) << (sizeof(T) * 8 - 1 - i);
+	}
+
+	return retVal;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+constexpr typename CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::Table
+CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::generateTable()
+{
+	const T invertedPolynomial = invertBitSequence(POLYNOMIAL);
+	Table table = {};
+	for (size_t value = 0; value < 256; value++)
+	{
+		T crc = static_cast<T>(value);
+		for (int i = 0; i < 8; i++)
+			crc = (crc & 1) ? static_cast<T>((crc >> 1) ^ invertedPolynomial) : static_cast<T>(crc >> 1);
+		table.entries[0][value] = crc;
+	}
+	for (size_t slice = 1; slice < SLICES; slice++)
+	{
+		for (size_t value = 0; value < 256; value++)
+		{
+			T previous = table.entries[slice - 1][value];
+			table.entries[slice][value] = static_cast<T>((previous >> 4) >> 4) ^ table.entries[0][static_cast<uint8_t>(previous)];
+		}
+	}
+
+	return table;
+}
+
+template <typename T, T POLYNOMIAL, T DEFAULT_INITVALUE, T DEFAULT_FINALXOR, size_t SLICES>
+constexpr typename CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::Table
+CrcSoftwareTable<T, POLYNOMIAL, DEFAULT_INITVALUE, DEFAULT_FINALXOR, SLICES>::kTable;
+
+/** Typedef for table driven Crc32 calculation*/
+typedef CrcSoftwareTable<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF> Crc32SoftwareTable;
+/** Typedef for table driven Crc16 calculation*/
+typedef CrcSoftwareTable<uint16_t, 0x1021, 0xFFFF, 0xFFFF> Crc16SoftwareTable;
+/** Typedef for table driven Crc8 calculation*/
+typedef CrcSoftwareTable<uint8_t, 0x07, 0xFF, 0xFF> Crc8SoftwareTable;
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_CRCSOFTWARETABLE_H_ */
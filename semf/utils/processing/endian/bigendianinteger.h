@@ -27,6 +27,9 @@ namespace semf
 {
 /**
  * @brief Class for representing big-endian numbers.
+ *
+ * The class has the size of \c T and no virtual functions, so it can be used as member of a struct packed by
+ * \c #pragma \c pack(1), which is placed on a received frame to read its big-endian fields without copying it.
  * @tparam T Native type of the number.
  */
 template <typename T>
@@ -38,7 +41,6 @@ public:
 	 * @param value Value of the number.
 	 */
 	constexpr BigEndianInteger(T value);
-	virtual ~BigEndianInteger() = default;
 
 	/**
 	 * @brief Returns the maximum (finite) value representable by the numeric type T.
@@ -15,6 +15,13 @@
 #include <semf/utils/processing/stdworkarounds/bit>
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
 
 namespace semf
 {
@@ -32,6 +39,10 @@ using uint64be = BigEndianInteger<uint64_t>;
 using uint64le = LittleEndianInteger<uint64_t>;
 /**
  * @brief The \c Endian class provides a set of functions for handeling the conversion of data with a specific endianess.
+ *
+ * Arrays are converted by \c swap(), which uses \c __builtin_bswap (REV instructions on ARM) for single numbers
+ * and SSSE3 or AVX2 byte shuffles for blocks of 16 or 32 bytes on x86 builds with these instruction sets enabled.
+ * The arrays do not need to be aligned, so numbers can be converted straight out of a received frame.
  */
 class Endian
 {
@@ -138,30 +149,59 @@ public:
 	 */
 	template <typename T>
 	static T toLittleEndian(T data);
+	/**
+	 * @brief Reverses the byte order of \c size numbers from \c data and stores them in \c buffer.
+	 * @note \c data and \c buffer may be the same array, but must not overlap otherwise.
+	 * @tparam T Type of the numbers, size has to be 1, 2, 4 or 8 byte.
+	 * @param data Numbers to swap.
+	 * @param size The count (!) of numbers.
+	 * @param buffer Buffer for storing the swapped numbers.
+	 */
+	template <typename T>
+	static void swap(const void* data, size_t size, void* buffer);
+	/**
+	 * @brief Reverses the byte order of \c size numbers in place.
+	 * @tparam T Type of the numbers, size has to be 1, 2, 4 or 8 byte.
+	 * @param data Numbers to swap.
+	 * @param size The count (!) of numbers.
+	 */
+	template <typename T>
+	static void swap(void* data, size_t size);
 
 private:
 	Endian() = default;
+
+	/**
+	 * @brief Reverses the byte order of a number.
+	 * @param value Number to swap.
+	 * @return Swapped number.
+	 */
+	static uint16_t swapBytes(uint16_t value);
+	/**
+	 * @brief Reverses the byte order of a number.
+	 * @param value Number to swap.
+	 * @return Swapped number.
+	 */
+	static uint32_t swapBytes(uint32_t value);
+	/**
+	 * @brief Reverses the byte order of a number.
+	 * @param value Number to swap.
+	 * @return Swapped number.
+	 */
+	static uint64_t swapBytes(uint64_t value);
 };
 
 template <typename T>
 void Endian::fromBigEndian(const void* data, size_t size, void* buffer)
 {
-	const T* typedData = reinterpret_cast<const T*>(data);
-	T* typedBuffer = reinterpret_cast<T*>(buffer);
-
 	if (std::endian::big == std::endian::native)
 	{
-		std::copy(typedData, typedData + size, typedBuffer);
+		if (data != buffer)
+			std::memcpy(buffer, data, size * sizeof(T));
 	}
 	else
 	{
-		std::for_each(typedData, typedData + size,
-					  [&](T value)
-					  {
-						  std::reverse_copy(reinterpret_cast<uint8_t*>(&value), reinterpret_cast<uint8_t*>(&value) + sizeof(T),
-											reinterpret_cast<uint8_t*>(typedBuffer));
-						  typedBuffer++;
-					  });
+		Endian::swap<T>(data, size, buffer);
 	}
 }
 
@@ -182,22 +222,14 @@ T Endian::fromBigEndian(T data)
 template <typename T>
 void Endian::fromLittleEndian(const void* data, size_t size, void* buffer)
 {
-	const T* typedData = reinterpret_cast<const T*>(data);
-	T* typedBuffer = reinterpret_cast<T*>(buffer);
-
 	if (std::endian::little == std::endian::native)
 	{
-		std::copy(typedData, typedData + size, typedBuffer);
+		if (data != buffer)
+			std::memcpy(buffer, data, size * sizeof(T));
 	}
 	else
 	{
-		std::for_each(typedData, typedData + size,
-					  [&](T value)
-					  {
-						  std::reverse_copy(reinterpret_cast<uint8_t*>(&value), reinterpret_cast<uint8_t*>(&value) + sizeof(T),
-											reinterpret_cast<uint8_t*>(typedBuffer));
-						  typedBuffer++;
-					  });
+		Endian::swap<T>(data, size, buffer);
 	}
 }
 
@@ -254,5 +286,86 @@ T Endian::toLittleEndian(T data)
 	Endian::toLittleEndian<T>(data, &value);
 	return value;
 }
+
+template <typename T>
+void Endian::swap(const void* data, size_t size, void* buffer)
+{
+	static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "T has to be 1, 2, 4 or 8 byte");
+	typedef typename std::conditional<sizeof(T) == 2, uint16_t, typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type Bits;
+
+	const uint8_t* in = static_cast<const uint8_t*>(data);
+	uint8_t* out = static_cast<uint8_t*>(buffer);
+	if (sizeof(T) == 1)
+	{
+		if (data != buffer)
+			std::memcpy(buffer, data, size);
+		return;
+	}
+
+	size_t i = 0;
+#if defined(__AVX2__) || defined(__SSSE3__)
+	if (size >= 16 / sizeof(T))
+	{
+		// byte order within each 16 byte lane: reversed bytes of every number
+		uint8_t order[32];
+		for (uint8_t j = 0; j < sizeof(order); j++)
+			order[j] = static_cast<uint8_t>(((j % 16) / sizeof(T)) * sizeof(T) + sizeof(T) - 1 - (j % 16) % sizeof(T));
+#if defined(__AVX2__)
+		const __m256i order256 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(order));
+		for (; i + 32 / sizeof(T) <= size; i += 32 / sizeof(T))
+		{
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * sizeof(T)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * sizeof(T)), _mm256_shuffle_epi8(block, order256));
+		}
+#endif
+		const __m128i order128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(order));
+		for (; i + 16 / sizeof(T) <= size; i += 16 / sizeof(T))
+		{
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * sizeof(T)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * sizeof(T)), _mm_shuffle_epi8(block, order128));
+		}
+	}
+#endif
+	for (; i < size; i++)
+	{
+		Bits value;
+		std::memcpy(&value, in + i * sizeof(T), sizeof(T));
+		value = swapBytes(value);
+		std::memcpy(out + i * sizeof(T), &value, sizeof(T));
+	}
+}
+
+template <typename T>
+void Endian::swap(void* data, size_t size)
+{
+	Endian::swap<T>(data, size, data);
+}
+
+inline uint16_t Endian::swapBytes(uint16_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap16(value);
+#else
+	return static_cast<uint16_t>((value << 8) | (value >> 8));
+#endif
+}
+
+inline uint32_t Endian::swapBytes(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap32(value);
+#else
+	return (value << 24) | ((value << 8) & 0x00FF0000) | ((value >> 8) & 0x0000FF00) | (value >> 24);
+#endif
+}
+
+inline uint64_t Endian::swapBytes(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap64(value);
+#else
+	return (static_cast<uint64_t>(swapBytes(static_cast<uint32_t>(value))) << 32) | swapBytes(static_cast<uint32_t>(value >> 32));
+#endif
+}
 }  // namespace semf
 #endif  // SEMF_UTILS_PROCESSING_ENDIAN_ENDIAN_H_
@@ -0,0 +1,115 @@
+/**
+ * @file endianarrayview.h
+ * @date 16.10.2026
+ * @author jh
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_ENDIAN_ENDIANARRAYVIEW_H_
+#define SEMF_UTILS_PROCESSING_ENDIAN_ENDIANARRAYVIEW_H_
+
+#include <semf/utils/processing/endian/endian.h>
+#include <semf/utils/processing/stdworkarounds/bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Read-only view on an array of numbers with a specific endianess, e.g. in a received frame.
+ *
+ * The numbers are converted when they are accessed, so no conversion pass over the whole array and no
+ * copy of it is needed. The array does not need to be aligned.
+ *
+ * @tparam T Native type of the numbers.
+ * @tparam ENDIAN Endianess of the numbers in the array.
+ */
+template <typename T, std::endian ENDIAN>
+class EndianArrayView
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param data Array of numbers.
+	 * @param size The count (!) of numbers.
+	 */
+	EndianArrayView(const void* data, size_t size);
+
+	/**
+	 * @brief Returns a number of the array converted to the native representation.
+	 * @param index Index of the number.
+	 * @return Converted number.
+	 */
+	T operator[](size_t index) const;
+	/**
+	 * @brief Converts numbers of the array and stores them in a native representation in \c buffer.
+	 * @param buffer Buffer for storing the numbers.
+	 * @param index Index of the first number to convert.
+	 * @param count The count (!) of numbers to convert.
+	 */
+	void copyTo(T buffer[], size_t index, size_t count) const;
+	/**
+	 * @brief Returns the count of numbers in the array.
+	 * @return Count of numbers.
+	 */
+	size_t size() const;
+	/**
+	 * @brief Returns the array.
+	 * @return Array of numbers.
+	 */
+	const void* data() const;
+
+private:
+	/**Array of numbers.*/
+	const uint8_t* m_data;
+	/**Count of numbers.*/
+	size_t m_size;
+};
+
+/**View on an array of big-endian numbers.*/
+template <typename T>
+using BigEndianArrayView = EndianArrayView<T, std::endian::big>;
+/**View on an array of little-endian numbers.*/
+template <typename T>
+using LittleEndianArrayView = EndianArrayView<T, std::endian::little>;
+
+template <typename T, std::endian ENDIAN>
+EndianArrayView<T, ENDIAN>::EndianArrayView(const void* data, size_t size)
+: m_data(static_cast<const uint8_t*>(data)),
+  m_size(size)
+{
+}
+
+template <typename T, std::endian ENDIAN>
+T EndianArrayView<T, ENDIAN>::operator[](size_t index) const
+{
+	if (ENDIAN == std::endian::big)
+		return Endian::fromBigEndian<T>(m_data + index * sizeof(T));
+	else
+		return Endian::fromLittleEndian<T>(m_data + index * sizeof(T));
+}
+
+template <typename T, std::endian ENDIAN>
+void EndianArrayView<T, ENDIAN>::copyTo(T buffer[], size_t index, size_t count) const
+{
+	if (ENDIAN == std::endian::big)
+		Endian::fromBigEndian<T>(m_data + index * sizeof(T), count, buffer);
+	else
+		Endian::fromLittleEndian<T>(m_data + index * sizeof(T), count, buffer);
+}
+
+template <typename T, std::endian ENDIAN>
+size_t EndianArrayView<T, ENDIAN>::size() const
+{
+	return m_size;
+}
+
+template <typename T, std::endian ENDIAN>
+const void* EndianArrayView<T, ENDIAN>::data() const
+{
+	return m_data;
+}
+}  // namespace semf
+#endif  // SEMF_UTILS_PROCESSING_ENDIAN_ENDIANARRAYVIEW_H_
@@ -26,6 +26,9 @@ namespace semf
 {
 /**
  * @brief Class for representing little-endian numbers.
+ *
+ * The class has the size of \c T and no virtual functions, so it can be used as member of a struct packed by
+ * \c #pragma \c pack(1), which is placed on a received frame to read its little-endian fields without copying it.
  * @tparam T Native type of the number.
  */
 template <typename T>
@@ -37,7 +40,6 @@ public:
 	 * @param value Value of the number.
 	 */
 	constexpr LittleEndianInteger(T value);
-	virtual ~LittleEndianInteger() = default;
 
 	/**
 	 * @brief Returns the maximum (finite) value representable by the numeric type T.
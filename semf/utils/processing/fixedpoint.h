@@ -0,0 +1,311 @@
+/**
+ * @file fixedpoint.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_FIXEDPOINT_H_
+#define SEMF_UTILS_PROCESSING_FIXEDPOINT_H_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace semf
+{
+/**
+ * @brief \c FixedPoint is a signed fixed-point number in Q format with saturating arithmetic.
+ *
+ * The number is stored as integer \c raw with the value raw / 2^FRACTION_BITS. All operations saturate at
+ * \c min() and \c max() instead of overflowing, multiplications are rounded to the nearest value.
+ * Multiplications use the wide type with twice the size of \c T, so on cores without floating point unit
+ * they are a lot faster than \c float or \c double operations.
+ *
+ * @tparam T Integer type of the raw value, \c int16_t or \c int32_t.
+ * @tparam FRACTION_BITS Number of fraction bits, e.g. 15 for Q15 with a value range of [-1, 1).
+ */
+template <typename T, uint8_t FRACTION_BITS>
+class FixedPoint
+{
+public:
+	static_assert(std::is_same<T, int16_t>::value || std::is_same<T, int32_t>::value, "T has to be int16_t or int32_t");
+	static_assert(FRACTION_BITS > 0 && FRACTION_BITS < sizeof(T) * 8, "FRACTION_BITS has to be between 1 and the number of bits of T minus one");
+
+	/**Type of the raw value.*/
+	typedef T Raw;
+	/**Type with twice the size of \c Raw for intermediate results.*/
+	typedef typename std::conditional<std::is_same<T, int16_t>::value, int32_t, int64_t>::type Wide;
+	/**Number of fraction bits.*/
+	static constexpr uint8_t kFractionBits = FRACTION_BITS;
+
+	/**Constructor for the value zero.*/
+	constexpr FixedPoint() = default;
+
+	/**
+	 * @brief Creates a number from its raw value.
+	 * @param raw Raw value, value * 2^FRACTION_BITS.
+	 * @return Number.
+	 */
+	static constexpr FixedPoint fromRaw(T raw);
+	/**
+	 * @brief Creates a number from a floating point value, rounded to the nearest and saturated.
+	 * @note Intended for initialization, because floating point is slow on cores without FPU.
+	 * @param value Floating point value, infinities are saturated.
+	 * @return Number, zero for NaN.
+	 */
+	static FixedPoint fromDouble(double value);
+	/**
+	 * @brief Creates a number from a wide raw value, saturated to the value range.
+	 * @param raw Wide raw value, value * 2^FRACTION_BITS.
+	 * @return Number.
+	 */
+	static constexpr FixedPoint saturate(Wide raw);
+	/**
+	 * @brief Returns the biggest representable number.
+	 * @return Maximum value.
+	 */
+	static constexpr FixedPoint max();
+	/**
+	 * @brief Returns the smallest representable number.
+	 * @return Minimum value.
+	 */
+	static constexpr FixedPoint min();
+
+	/**
+	 * @brief Returns the raw value.
+	 * @return Raw value, value * 2^FRACTION_BITS.
+	 */
+	constexpr T raw() const;
+	/**
+	 * @brief Converts the number to floating point.
+	 * @return Floating point value.
+	 */
+	double toDouble() const;
+
+	/**
+	 * @brief Performs a saturating addition.
+	 * @param other Summand.
+	 * @return Sum.
+	 */
+	constexpr FixedPoint operator+(FixedPoint other) const;
+	/**
+	 * @brief Performs a saturating subtraction.
+	 * @param other Subtrahend.
+	 * @return Difference.
+	 */
+	constexpr FixedPoint operator-(FixedPoint other) const;
+	/**
+	 * @brief Negates the number saturating, so the negated \c min() is \c max().
+	 * @return Negated number.
+	 */
+	constexpr FixedPoint operator-() const;
+	/**
+	 * @brief Performs a saturating multiplication rounded to the nearest.
+	 * @param other Factor.
+	 * @return Product.
+	 */
+	constexpr FixedPoint operator*(FixedPoint other) const;
+	/**
+	 * @brief Performs a saturating addition.
+	 * @param other Summand.
+	 * @return Reference to \c this.
+	 */
+	FixedPoint& operator+=(FixedPoint other);
+	/**
+	 * @brief Performs a saturating subtraction.
+	 * @param other Subtrahend.
+	 * @return Reference to \c this.
+	 */
+	FixedPoint& operator-=(FixedPoint other);
+	/**
+	 * @brief Performs a saturating multiplication rounded to the nearest.
+	 * @param other Factor.
+	 * @return Reference to \c this.
+	 */
+	FixedPoint& operator*=(FixedPoint other);
+	/**
+	 * @brief Checks if \c this and \c other are equal.
+	 * @param other Other number.
+	 * @return \c true if equal.
+	 */
+	constexpr bool operator==(FixedPoint other) const;
+	/**
+	 * @brief Checks if \c this and \c other are unequal.
+	 * @param other Other number.
+	 * @return \c true if unequal.
+	 */
+	constexpr bool operator!=(FixedPoint other) const;
+	/**
+	 * @brief Checks if \c this is smaller than \c other.
+	 * @param other Other number.
+	 * @return \c true if smaller.
+	 */
+	constexpr bool operator<(FixedPoint other) const;
+	/**
+	 * @brief Checks if \c this is bigger than \c other.
+	 * @param other Other number.
+	 * @return \c true if bigger.
+	 */
+	constexpr bool operator>(FixedPoint other) const;
+	/**
+	 * @brief Checks if \c this is smaller than or equal to \c other.
+	 * @param other Other number.
+	 * @return \c true if smaller or equal.
+	 */
+	constexpr bool operator<=(FixedPoint other) const;
+	/**
+	 * @brief Checks if \c this is bigger than or equal to \c other.
+	 * @param other Other number.
+	 * @return \c true if bigger or equal.
+	 */
+	constexpr bool operator>=(FixedPoint other) const;
+
+private:
+	/**Raw value.*/
+	T m_raw = 0;
+};
+
+/**Signed fixed-point number with 15 fraction bits and the value range [-1, 1).*/
+typedef FixedPoint<int16_t, 15> Q15;
+/**Signed fixed-point number with 31 fraction bits and the value range [-1, 1).*/
+typedef FixedPoint<int32_t, 31> Q31;
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::fromRaw(T raw)
+{
+	FixedPoint number;
+	number.m_raw = raw;
+	return number;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::fromDouble(double value)
+{
+	if (std::isnan(value))
+		return FixedPoint();
+	double scaled = value * static_cast<double>(static_cast<Wide>(1) << FRACTION_BITS);
+	if (scaled >= static_cast<double>(std::numeric_limits<T>::max()))
+		return max();
+	if (scaled <= static_cast<double>(std::numeric_limits<T>::min()))
+		return min();
+	return fromRaw(static_cast<T>(scaled < 0 ? scaled - 0.5 : scaled + 0.5));
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::saturate(Wide raw)
+{
+	return fromRaw(raw > std::numeric_limits<T>::max()	 ? std::numeric_limits<T>::max()
+				   : raw < std::numeric_limits<T>::min() ? std::numeric_limits<T>::min()
+														 : static_cast<T>(raw));
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::max()
+{
+	return fromRaw(std::numeric_limits<T>::max());
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::min()
+{
+	return fromRaw(std::numeric_limits<T>::min());
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr T FixedPoint<T, FRACTION_BITS>::raw() const
+{
+	return m_raw;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+double FixedPoint<T, FRACTION_BITS>::toDouble() const
+{
+	return static_cast<double>(m_raw) / static_cast<double>(static_cast<Wide>(1) << FRACTION_BITS);
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::operator+(FixedPoint other) const
+{
+	return saturate(static_cast<Wide>(m_raw) + other.m_raw);
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::operator-(FixedPoint other) const
+{
+	return saturate(static_cast<Wide>(m_raw) - other.m_raw);
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::operator-() const
+{
+	return saturate(-static_cast<Wide>(m_raw));
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr FixedPoint<T, FRACTION_BITS> FixedPoint<T, FRACTION_BITS>::operator*(FixedPoint other) const
+{
+	return saturate((static_cast<Wide>(m_raw) * other.m_raw + (static_cast<Wide>(1) << (FRACTION_BITS - 1))) >> FRACTION_BITS);
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+FixedPoint<T, FRACTION_BITS>& FixedPoint<T, FRACTION_BITS>::operator+=(FixedPoint other)
+{
+	*this = *this + other;
+	return *this;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+FixedPoint<T, FRACTION_BITS>& FixedPoint<T, FRACTION_BITS>::operator-=(FixedPoint other)
+{
+	*this = *this - other;
+	return *this;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+FixedPoint<T, FRACTION_BITS>& FixedPoint<T, FRACTION_BITS>::operator*=(FixedPoint other)
+{
+	*this = *this * other;
+	return *this;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr bool FixedPoint<T, FRACTION_BITS>::operator==(FixedPoint other) const
+{
+	return m_raw == other.m_raw;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr bool FixedPoint<T, FRACTION_BITS>::operator!=(FixedPoint other) const
+{
+	return m_raw != other.m_raw;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr bool FixedPoint<T, FRACTION_BITS>::operator<(FixedPoint other) const
+{
+	return m_raw < other.m_raw;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr bool FixedPoint<T, FRACTION_BITS>::operator>(FixedPoint other) const
+{
+	return m_raw > other.m_raw;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr bool FixedPoint<T, FRACTION_BITS>::operator<=(FixedPoint other) const
+{
+	return m_raw <= other.m_raw;
+}
+
+template <typename T, uint8_t FRACTION_BITS>
+constexpr bool FixedPoint<T, FRACTION_BITS>::operator>=(FixedPoint other) const
+{
+	return m_raw >= other.m_raw;
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_FIXEDPOINT_H_ */
@@ -0,0 +1,33 @@
+/**
+ * @file galoisfield256.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/processing/galoisfield256.h>
+
+namespace semf
+{
+constexpr GaloisField256::Tables GaloisField256::generateTables()
+{
+	Tables tables = {};
+	unsigned int value = 1;
+	for (size_t i = 0; i < 255; i++)
+	{
+		tables.exponential[i] = static_cast<uint8_t>(value);
+		tables.exponential[i + 255] = static_cast<uint8_t>(value);
+		tables.logarithm[value] = static_cast<uint8_t>(i);
+		value <<= 1;
+		if (value & 0x100)
+			value ^= 0x11d;
+	}
+	tables.exponential[510] = tables.exponential[0];
+	tables.exponential[511] = tables.exponential[1];
+	return tables;
+}
+
+const GaloisField256::Tables GaloisField256::kTables = GaloisField256::generateTables();
+} /* namespace semf */
@@ -0,0 +1,98 @@
+/**
+ * @file galoisfield256.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_GALOISFIELD256_H_
+#define SEMF_UTILS_PROCESSING_GALOISFIELD256_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Arithmetic in the Galois field GF(2^8) with the primitive polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11d).
+ *
+ * Addition and subtraction are xor. Multiplication and division use logarithm and antilogarithm tables, which are
+ * generated at compile time and shared by all users.
+ */
+class GaloisField256
+{
+public:
+	/**
+	 * @brief Multiplies two elements.
+	 * @param a First factor.
+	 * @param b Second factor.
+	 * @return Product.
+	 */
+	static uint8_t multiply(uint8_t a, uint8_t b);
+	/**
+	 * @brief Divides two elements.
+	 * @param a Dividend.
+	 * @param b Divisor, must not be zero.
+	 * @return Quotient.
+	 */
+	static uint8_t divide(uint8_t a, uint8_t b);
+	/**
+	 * @brief Returns a power of the primitive element alpha (2).
+	 * @param exponent Exponent, any value is reduced modulo 255.
+	 * @return alpha^exponent.
+	 */
+	static uint8_t power(size_t exponent);
+	/**
+	 * @brief Returns the logarithm to the base alpha.
+	 * @param value Element, must not be zero.
+	 * @return Logarithm between 0 and 254.
+	 */
+	static uint8_t logarithm(uint8_t value);
+
+private:
+	/**Lookup tables.*/
+	struct Tables
+	{
+		/**Powers of alpha, doubled for adding two logarithms without modulo.*/
+		uint8_t exponential[512];
+		/**Logarithms to the base alpha, the entry for zero is unused.*/
+		uint8_t logarithm[256];
+	};
+
+	/**
+	 * @brief Generates the lookup tables.
+	 * @return Lookup tables.
+	 */
+	static constexpr Tables generateTables();
+
+	/**Lookup tables generated at compile time.*/
+	static const Tables kTables;
+};
+
+inline uint8_t GaloisField256::multiply(uint8_t a, uint8_t b)
+{
+	if (a == 0 || b == 0)
+		return 0;
+	return kTables.exponential[kTables.logarithm[a] + kTables.logarithm[b]];
+}
+
+inline uint8_t GaloisField256::divide(uint8_t a, uint8_t b)
+{
+	if (a == 0)
+		return 0;
+	return kTables.exponential[kTables.logarithm[a] + 255 - kTables.logarithm[b]];
+}
+
+inline uint8_t GaloisField256::power(size_t exponent)
+{
+	return kTables.exponential[exponent % 255];
+}
+
+inline uint8_t GaloisField256::logarithm(uint8_t value)
+{
+	return kTables.logarithm[value];
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_GALOISFIELD256_H_ */
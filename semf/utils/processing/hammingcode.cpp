@@ -0,0 +1,133 @@
+/**
+ * @file hammingcode.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/hammingcode.h>
+
+namespace semf
+{
+constexpr HammingCode::Tables HammingCode::generateTables()
+{
+	// Code word bit n holds position n + 1: p1 p2 d1 p3 d2 d3 d4, the parity bit at position 2^k covers all
+	// positions with bit k set.
+	constexpr uint8_t dataPositions[4] = {3, 5, 6, 7};
+	Tables tables = {};
+	for (uint8_t nibble = 0; nibble < 16; nibble++)
+	{
+		uint8_t code = 0;
+		for (size_t i = 0; i < 4; i++)
+		{
+			if (nibble & (1 << i))
+				code |= static_cast<uint8_t>(1 << (dataPositions[i] - 1));
+		}
+		for (uint8_t parity = 1; parity < 8; parity <<= 1)
+		{
+			uint8_t sum = 0;
+			for (uint8_t position = 1; position < 8; position++)
+			{
+				if ((position & parity) && (code & (1 << (position - 1))))
+					sum ^= 1;
+			}
+			code |= static_cast<uint8_t>(sum << (parity - 1));
+		}
+		tables.encode[nibble] = code;
+	}
+
+	for (uint8_t code = 0; code < 128; code++)
+	{
+		uint8_t syndrome = 0;
+		for (uint8_t position = 1; position < 8; position++)
+		{
+			if (code & (1 << (position - 1)))
+				syndrome ^= position;
+		}
+		uint8_t corrected = syndrome != 0 ? static_cast<uint8_t>(code ^ (1 << (syndrome - 1))) : code;
+		uint8_t nibble = 0;
+		for (size_t i = 0; i < 4; i++)
+		{
+			if (corrected & (1 << (dataPositions[i] - 1)))
+				nibble |= static_cast<uint8_t>(1 << i);
+		}
+		tables.decode[code] = nibble;
+	}
+	return tables;
+}
+
+const HammingCode::Tables HammingCode::kTables = HammingCode::generateTables();
+
+size_t HammingCode::encode(const uint8_t data[], size_t dataBitSize, uint8_t buffer[], size_t bufferSize) const
+{
+	size_t bits = blockBitSize(dataBitSize);
+	if (bufferSize * 8 < bits)
+	{
+		SEMF_ERROR("buffer size %u too small", bufferSize);
+		return 0;
+	}
+
+	// Code words are collected in a word and written byte by byte.
+	uint32_t collected = 0;
+	size_t collectedBits = 0;
+	size_t nibbles = (dataBitSize + 3) / 4;
+	for (size_t i = 0; i < nibbles; i++)
+	{
+		uint8_t nibble = (data[i / 2] >> ((i % 2) * 4)) & 0x0f;
+		if (i + 1 == nibbles && dataBitSize % 4 != 0)
+			nibble &= static_cast<uint8_t>((1 << (dataBitSize % 4)) - 1);
+		collected |= static_cast<uint32_t>(kTables.encode[nibble]) << collectedBits;
+		collectedBits += 7;
+		while (collectedBits >= 8)
+		{
+			*buffer++ = static_cast<uint8_t>(collected);
+			collected >>= 8;
+			collectedBits -= 8;
+		}
+	}
+	if (collectedBits > 0)
+		*buffer = static_cast<uint8_t>(collected);
+
+	SEMF_INFO("encoded %u bits", bits);
+	return bits;
+}
+
+size_t HammingCode::decode(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize) const
+{
+	size_t nibbles = dataSize / 7;
+	if (bufferSize * 2 < nibbles)
+	{
+		SEMF_ERROR("buffer size %u too small", bufferSize);
+		return 0;
+	}
+
+	uint32_t collected = 0;
+	size_t collectedBits = 0;
+	for (size_t i = 0; i < nibbles; i++)
+	{
+		if (collectedBits < 7)
+		{
+			collected |= static_cast<uint32_t>(*data++) << collectedBits;
+			collectedBits += 8;
+		}
+		uint8_t nibble = kTables.decode[collected & 0x7f];
+		collected >>= 7;
+		collectedBits -= 7;
+
+		if (i % 2 == 0)
+			buffer[i / 2] = nibble;
+		else
+			buffer[i / 2] |= static_cast<uint8_t>(nibble << 4);
+	}
+	SEMF_INFO("decoded %u nibbles", nibbles);
+	return nibbles * 4;
+}
+
+size_t HammingCode::blockBitSize(size_t messageBitSize) const
+{
+	return (messageBitSize + 3) / 4 * 7;
+}
+} /* namespace semf */
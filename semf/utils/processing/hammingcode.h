@@ -0,0 +1,69 @@
+/**
+ * @file hammingcode.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_HAMMINGCODE_H_
+#define SEMF_UTILS_PROCESSING_HAMMINGCODE_H_
+
+#include <semf/app/processing/errorcorrectioncode.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Hamming(7,4) error correction code.
+ *
+ * Every four data bits are stored as a code word of seven bits, which corrects one bit error per code word.
+ * Encoding and decoding use lookup tables for whole nibbles and code words, the code words are packed
+ * continuously into the buffer starting with the least significant bit of the first byte.
+ *
+ * @note Data sizes are given in bits and buffer sizes in bytes.
+ * @note Two bit errors in a code word can not be detected and lead to a wrong correction, use \c Secded if
+ *       multiple bit errors have to be detected.
+ */
+class HammingCode : public app::ErrorCorrectionCode
+{
+public:
+	HammingCode() = default;
+	explicit HammingCode(const HammingCode& other) = delete;
+	virtual ~HammingCode() = default;
+
+	/**
+	 * @copydoc app::ErrorCorrectionCode::encode()
+	 * @return The number of bits that have been written into the buffer, zero if the buffer is too small.
+	 */
+	size_t encode(const uint8_t data[], size_t dataBitSize, uint8_t buffer[], size_t bufferSize) const override;
+	/**
+	 * @copydoc app::ErrorCorrectionCode::decode()
+	 * @return The number of bits that have been written into the buffer, zero if the buffer is too small.
+	 */
+	size_t decode(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize) const override;
+	size_t blockBitSize(size_t messageBitSize) const override;
+
+private:
+	/**Lookup tables.*/
+	struct Tables
+	{
+		/**Code word for each nibble.*/
+		uint8_t encode[16];
+		/**Corrected nibble for each code word.*/
+		uint8_t decode[128];
+	};
+
+	/**
+	 * @brief Generates the lookup tables.
+	 * @return Lookup tables.
+	 */
+	static constexpr Tables generateTables();
+
+	/**Lookup tables generated at compile time.*/
+	static const Tables kTables;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_HAMMINGCODE_H_ */
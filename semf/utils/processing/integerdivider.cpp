@@ -0,0 +1,82 @@
+/**
+ * @file integerdivider.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/processing/integerdivider.h>
+
+namespace semf
+{
+#ifdef __SIZEOF_INT128__
+/**Native 128 bit integer of GCC and Clang, \c __extension__ keeps \c -Wpedantic builds free of warnings.*/
+__extension__ typedef unsigned __int128 Uint128;
+#endif
+
+IntegerDivider::IntegerDivider(uint64_t divisor)
+{
+	setDivisor(divisor);
+}
+
+void IntegerDivider::setDivisor(uint64_t divisor)
+{
+	if (divisor == 0)
+		divisor = 1;
+	m_divisor = divisor;
+
+	// number of binary places of (divisor - 1), so 2^places is the smallest power of two not smaller than divisor
+	uint8_t places = 0;
+	while (places < 64 && ((divisor - 1) >> places) != 0)
+		places++;
+
+	// multiplier = floor(2^64 * (2^places - divisor) / divisor) + 1, calculated by a shift-subtract division
+	uint64_t remainder = (places == 64) ? 0 - divisor : (static_cast<uint64_t>(1) << places) - divisor;
+	uint64_t quotient = 0;
+	for (uint8_t i = 0; i < 64; i++)
+	{
+		bool carry = (remainder >> 63) != 0;
+		remainder <<= 1;
+		quotient <<= 1;
+		if (carry || remainder >= divisor)
+		{
+			remainder -= divisor;
+			quotient |= 1;
+		}
+	}
+	m_multiplier = quotient + 1;
+	m_shift1 = places > 0 ? 1 : 0;
+	m_shift2 = places > 0 ? places - 1 : 0;
+}
+
+uint64_t IntegerDivider::divisor() const
+{
+	return m_divisor;
+}
+
+uint64_t IntegerDivider::divide(uint64_t dividend) const
+{
+	uint64_t product = multiplyHigh(m_multiplier, dividend);
+	return (product + ((dividend - product) >> m_shift1)) >> m_shift2;
+}
+
+uint64_t IntegerDivider::multiplyHigh(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+	return static_cast<uint64_t>((static_cast<Uint128>(a) * b) >> 64);
+#else
+	uint64_t aLow = a & 0xFFFFFFFF;
+	uint64_t aHigh = a >> 32;
+	uint64_t bLow = b & 0xFFFFFFFF;
+	uint64_t bHigh = b >> 32;
+
+	uint64_t lowLow = aLow * bLow;
+	uint64_t lowHigh = aLow * bHigh;
+	uint64_t highLow = aHigh * bLow;
+	uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+	return aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+} /* namespace semf */
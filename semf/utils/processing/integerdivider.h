@@ -0,0 +1,70 @@
+/**
+ * @file integerdivider.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_INTEGERDIVIDER_H_
+#define SEMF_UTILS_PROCESSING_INTEGERDIVIDER_H_
+
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief \c IntegerDivider divides unsigned 64 bit integers by a fixed divisor without a division instruction.
+ *
+ * The constructor precomputes a magic multiplier and two shifts for the divisor (Granlund and Montgomery), so
+ * every \c divide() is a multiplication of the high half and some shifts. The quotient is exact for all
+ * dividends. Computing the magic numbers costs about as much as a single software division, so it pays off if
+ * the same divisor is used more than once, e.g. the window size of an average.
+ */
+class IntegerDivider
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param divisor Number to divide by, zero is handled like one.
+	 */
+	explicit IntegerDivider(uint64_t divisor = 1);
+
+	/**
+	 * @brief Sets a new divisor and precomputes its magic numbers.
+	 * @param divisor Number to divide by, zero is handled like one.
+	 */
+	void setDivisor(uint64_t divisor);
+	/**
+	 * @brief Returns the divisor.
+	 * @return Divisor.
+	 */
+	uint64_t divisor() const;
+	/**
+	 * @brief Divides a number through the divisor.
+	 * @param dividend Number to divide.
+	 * @return Quotient rounded down.
+	 */
+	uint64_t divide(uint64_t dividend) const;
+
+private:
+	/**
+	 * @brief Returns the high 64 bit of the 128 bit product of two numbers.
+	 * @param a First factor.
+	 * @param b Second factor.
+	 * @return High half of the product.
+	 */
+	static uint64_t multiplyHigh(uint64_t a, uint64_t b);
+
+	/**Divisor.*/
+	uint64_t m_divisor = 1;
+	/**Magic multiplier.*/
+	uint64_t m_multiplier = 1;
+	/**Shift of the difference between dividend and product, zero or one.*/
+	uint8_t m_shift1 = 0;
+	/**Shift of the final sum.*/
+	uint8_t m_shift2 = 0;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_INTEGERDIVIDER_H_ */
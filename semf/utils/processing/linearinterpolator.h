@@ -22,6 +22,11 @@ namespace semf
  * i.e. \c x1 1st dimensional value, \c x2 2nd dimensional value. so a data point in 3d space (\c x1, \c x2, ,\c x3).
  * The corresponding value (target) of a given point is notated as \c y .
  *
+ * The breakpoints of every dimension have to be sorted ascending. The surrounding breakpoints of a point are found
+ * by a binary search. If the breakpoints of a dimension are (nearly) equally spaced, which is detected by \c init()
+ * or can be set by \c setSpacing(), their index is calculated directly instead. Additionally the breakpoints of the
+ * last interpolation are checked first, so slowly changing inputs need only two comparisons per dimension.
+ *
  * @tparam MAX_DIMENTIONS Maximum dimensions for interpolation (1, 2, or 3).
  * @tparam T_IN Data type of inputs.
  * @tparam T_TARGET Data type of outputs.
@@ -31,6 +36,13 @@ template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET = T_IN, typen
 class LinearInterpolator
 {
 public:
+	/**Spacing of the breakpoints of a dimension.*/
+	enum class Spacing : uint8_t
+	{
+		Arbitrary = 0,  //!< Breakpoints are searched by a binary search.
+		Uniform  //!< Index of the breakpoints is calculated from the distance of the first two breakpoints.
+	};
+
 	/**
 	 * Constructor.
 	 * @param limitToBoundaryValues Flag that allows accepting input data beyond the boundaries, without throwing an error.
@@ -93,6 +105,21 @@ public:
 	 */
 	bool setTargetDataInputDimension(const T_TARGET targetData[], uint16_t targetDataSize);
 
+	/**
+	 * @brief Overwrites the spacing of a dimension detected by \c init().
+	 * @note Setting \c Spacing::Uniform for not equally spaced breakpoints is slower, but still correct.
+	 * @param dimension Index of the dimension, starting at zero.
+	 * @param spacing Spacing of the breakpoints.
+	 */
+	void setSpacing(uint8_t dimension, Spacing spacing);
+
+	/**
+	 * @brief Returns the spacing of a dimension.
+	 * @param dimension Index of the dimension, starting at zero.
+	 * @return Spacing of the breakpoints.
+	 */
+	Spacing spacing(uint8_t dimension) const;
+
 	/**
 	 * @brief Calculates the interpolation of a given data point.
 	 * @param y Reference to the result (interpolated value).
@@ -106,6 +133,19 @@ public:
 	 */
 	bool interpolate(T_TARGET& y, T_IN x1 = 0, T_IN x2 = 0, T_IN x3 = 0);
 
+	/**
+	 * @brief Calculates the interpolation of multiple data points.
+	 * @note Results of data points, which could not be interpolated, are not written.
+	 * @param y Array for the results (interpolated values).
+	 * @param count Number of data points.
+	 * @param x1 Input data values for the first dimension.
+	 * @param x2 Input data values for the second dimension, \c nullptr for using zero.
+	 * @param x3 Input data values for the third dimension, \c nullptr for using zero.
+	 * @return \li \c true if all data points are interpolated,
+	 * 		\li \c false if something goes wrong for at least one data point.
+	 */
+	bool interpolate(T_TARGET y[], size_t count, const T_IN x1[], const T_IN x2[] = nullptr, const T_IN x3[] = nullptr);
+
 private:
 	/**
 	 * @brief Performs 1D interpolation.
@@ -132,6 +172,19 @@ private:
 	 */
 	void getPointIndecies();
 
+	/**
+	 * @brief Finds the index of the first breakpoint of a dimension, which is not smaller than the input data point.
+	 * @param dimension Index of the dimension.
+	 * @return Index of the breakpoint, number of breakpoints if all of them are smaller.
+	 */
+	uint16_t findBiggerIndex(uint8_t dimension);
+
+	/**
+	 * @brief Checks whether the breakpoints of a dimension are equally spaced and sets the spacing.
+	 * @param dimension Index of the dimension.
+	 */
+	void detectSpacing(uint8_t dimension);
+
 	/**
 	 * @brief Checks the indices surrounding the input data point whether it exceeds dimension's boundaries or not.
 	 */
@@ -159,6 +212,12 @@ private:
 	uint8_t m_consideredDimCtr = 0;
 	/** It stores number of elements/points in each dimension.*/
 	uint16_t m_dimLen[MAX_DIMENSIONS] = {0};
+	/** It stores the spacing of the breakpoints in each dimension.*/
+	Spacing m_spacing[MAX_DIMENSIONS] = {Spacing::Arbitrary};
+	/** It stores the distance between the breakpoints of uniformly spaced dimensions.*/
+	T_IN m_step[MAX_DIMENSIONS] = {0};
+	/** It stores the bigger index of the last interpolation for every dimension.*/
+	uint16_t m_lastIndex[MAX_DIMENSIONS] = {0};
 	/** It stores number of elements/points of targetDataput data.*/
 	uint16_t m_targetDataSize = 0;
 	/** It stores the point indices, which are smaller in value than the
@@ -198,6 +257,7 @@ bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::init(const T
 	{
 		m_dim[0] = dimension1Data;
 		m_dimLen[0] = dimension1DataSize;
+		detectSpacing(0);
 		m_targetData = targetData;
 		m_targetDataSize = targetDataSize;
 		m_retValue = true;
@@ -219,6 +279,8 @@ bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::init(const T
 		m_dim[1] = dimension2Data;
 		m_dimLen[0] = dimension1DataSize;
 		m_dimLen[1] = dimension2DataSize;
+		detectSpacing(0);
+		detectSpacing(1);
 		m_targetData = targetData;
 		m_targetDataSize = targetDataSize;
 		m_retValue = true;
@@ -244,6 +306,9 @@ bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::init(const T
 		m_dimLen[0] = dimension1DataSize;
 		m_dimLen[1] = dimension2DataSize;
 		m_dimLen[2] = dimension3DataSize;
+		detectSpacing(0);
+		detectSpacing(1);
+		detectSpacing(2);
 		m_targetData = targetData;
 		m_targetDataSize = targetDataSize;
 		m_retValue = true;
@@ -266,6 +331,32 @@ bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::setTargetDat
 	return m_retValue;
 }
 
+template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
+void LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::setSpacing(uint8_t dimension, Spacing spacing)
+{
+	if (dimension >= MAX_DIMENSIONS)
+		return;
+
+	m_spacing[dimension] = spacing;
+	if (spacing == Spacing::Uniform)
+	{
+		// no step of a previous initialization is kept, if the new breakpoints do not give one
+		m_step[dimension] = 0;
+		if (m_dimLen[dimension] >= 2 && m_dim[dimension][0] < m_dim[dimension][m_dimLen[dimension] - 1])
+			m_step[dimension] = (m_dim[dimension][m_dimLen[dimension] - 1] - m_dim[dimension][0]) / static_cast<T_IN>(m_dimLen[dimension] - 1);
+		// a step of zero (e.g. integer breakpoints closer than one) can not be used for calculating an index
+		if (!(m_step[dimension] > 0))
+			m_spacing[dimension] = Spacing::Arbitrary;
+	}
+}
+
+template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
+typename LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::Spacing LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::spacing(
+	uint8_t dimension) const
+{
+	return dimension < MAX_DIMENSIONS ? m_spacing[dimension] : Spacing::Arbitrary;
+}
+
 template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
 bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::interpolate(T_TARGET& y, T_IN x1, T_IN x2, T_IN x3)
 {
@@ -280,9 +371,11 @@ bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::interpolate(
 		m_iSVec[i] = 0;
 		m_considDim[i] = 0;
 	}
-	m_xVal[0] = x1;
-	m_xVal[1] = x2;
-	m_xVal[2] = x3;
+	const T_IN x[3] = {x1, x2, x3};
+	for (uint8_t i = 0; i < MAX_DIMENSIONS; i++)
+	{
+		m_xVal[i] = x[i];
+	}
 	m_consideredDimCtr = 0;
 	calculateNeighboringPoints();
 	if (m_retValue)
@@ -310,6 +403,25 @@ bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::interpolate(
 	return m_retValue;
 }
 
+template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
+bool LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::interpolate(T_TARGET y[], size_t count, const T_IN x1[], const T_IN x2[], const T_IN x3[])
+{
+	if (y == nullptr || x1 == nullptr)
+	{
+		m_retValue = false;
+		return m_retValue;
+	}
+
+	bool success = true;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (!interpolate(y[i], x1[i], x2 != nullptr ? x2[i] : 0, x3 != nullptr ? x3[i] : 0))
+			success = false;
+	}
+	m_retValue = success;
+	return m_retValue;
+}
+
 template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
 void LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::interpolateInOneDimension()
 {
@@ -450,13 +562,10 @@ void LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::getPointInde
 		}
 
 		// finding targetData the index of the bigger index for each dimension.
-		while ((m_dim[i][m_iBVec[i]] < m_xVal[i]) && (m_iBVec[i] < m_dimLen[i]))
-		{
-			m_iBVec[i]++;
-		}
+		m_iBVec[i] = static_cast<int16_t>(findBiggerIndex(i));
 		// checks whether the chosen index is the same as the given
 		// point for each dimension, and counts the active dimensions.
-		if (m_dim[i][m_iBVec[i]] == m_xVal[i])
+		if (m_iBVec[i] < m_dimLen[i] && m_dim[i][m_iBVec[i]] == m_xVal[i])
 		{
 			m_iSVec[i] = m_iBVec[i];
 			m_dimReduction[i] = true;
@@ -471,6 +580,76 @@ void LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::getPointInde
 	checkDimensionBoundaries();
 }
 
+template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
+uint16_t LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::findBiggerIndex(uint8_t dimension)
+{
+	const T_IN* dim = m_dim[dimension];
+	const uint16_t len = m_dimLen[dimension];
+	const T_IN x = m_xVal[dimension];
+
+	if (len == 0 || !(dim[0] < x))
+		return 0;
+	if (dim[len - 1] < x)
+		return len;
+
+	// from here on dim[0] < x <= dim[len - 1], so the index is between 1 and len - 1
+	uint16_t index = m_lastIndex[dimension];
+	if (index > 0 && index < len && dim[index - 1] < x && !(dim[index] < x))
+		return index;
+
+	if (m_spacing[dimension] == Spacing::Uniform)
+	{
+		// calculated index is exact for equally spaced breakpoints, otherwise it is corrected step by step
+		T_IN offset = (x - dim[0]) / m_step[dimension];
+		index = offset < static_cast<T_IN>(len - 1) ? static_cast<uint16_t>(offset) : len - 1;
+		if (index < 1)
+			index = 1;
+		while (dim[index] < x)
+			index++;
+		while (!(dim[index - 1] < x))
+			index--;
+	}
+	else
+	{
+		// binary search written with a conditional move instead of a branch, because random inputs are unpredictable
+		const T_IN* first = dim + 1;
+		uint16_t count = len - 1;
+		while (count > 1)
+		{
+			uint16_t half = count / 2;
+			first = (first[half] < x) ? first + half : first;
+			count -= half;
+		}
+		index = static_cast<uint16_t>(first - dim) + (*first < x ? 1 : 0);
+	}
+	m_lastIndex[dimension] = index;
+	return index;
+}
+
+template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
+void LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::detectSpacing(uint8_t dimension)
+{
+	m_lastIndex[dimension] = 0;
+	setSpacing(dimension, Spacing::Uniform);
+	if (m_spacing[dimension] != Spacing::Uniform)
+		return;
+
+	// uniform, if every breakpoint is closer than half a step to its ideal position
+	const T_IN* dim = m_dim[dimension];
+	const T_IN step = m_step[dimension];
+	T_IN ideal = dim[0];
+	for (uint16_t i = 1; i < m_dimLen[dimension]; i++)
+	{
+		ideal += step;
+		T_IN deviation = dim[i] > ideal ? dim[i] - ideal : ideal - dim[i];
+		if (deviation + deviation > step)
+		{
+			m_spacing[dimension] = Spacing::Arbitrary;
+			return;
+		}
+	}
+}
+
 template <uint8_t MAX_DIMENSIONS, typename T_IN, typename T_TARGET, typename T_STORAGE>
 void LinearInterpolator<MAX_DIMENSIONS, T_IN, T_TARGET, T_STORAGE>::checkDimensionBoundaries()
 {
@@ -0,0 +1,402 @@
+/**
+ * @file pidcontrollerfixed.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_PIDCONTROLLERFIXED_H_
+#define SEMF_UTILS_PROCESSING_PIDCONTROLLERFIXED_H_
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/fixedpoint.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace semf
+{
+/**
+ * @brief Implementation of an pid (proportional integral derivative) regulator in fixed-point arithmetic.
+ *
+ * Works like \c PidController, but the setpoint, the current value and the output are \c FixedPoint numbers,
+ * so \c calculate() does not need any floating point operation. The coefficients are given as \c double and
+ * converted once to the coefficients q0, q1 and q2. They are 32 bit integers independent from \c Q and share a
+ * number of fraction bits, which is chosen as big as possible while the sum of their absolute values fits into
+ * 32 bit. So small coefficients like Ki * sampleTime keep their precision, also for \c Q15, and coefficients
+ * bigger than the value range of \c Q are possible. The products with the control errors are summed in 64 bit.
+ *
+ * @note The values have to be scaled into the value range of \c Q by the user, e.g. [-1, 1) for \c Q15.
+ *       The control error (setpoint - current value) is saturated to this range, too.
+ * @note If the sum of the absolute coefficients does not fit into 32 bit without fraction bits, all three
+ *       coefficients are reduced by the same factor, which lowers the gain of the controller.
+ *
+ * @tparam Q Fixed-point type, e.g. \c Q15 or \c Q31.
+ */
+template <typename Q>
+class PidControllerFixed
+{
+public:
+	/**
+	 * @brief Constructor
+	 * @param kp Proportional coefficient.
+	 * @param ki Integral coefficient.
+	 * @param kd Derivative coefficient.
+	 * @param sampleTime The sampling time [s].
+	 * @param yMin The minimum output value.
+	 * @param yMax The maximum output value.
+	 * @param setpoint The value on which the output is to be regulated.
+	 * @param yStart This value is used for the first calculation.
+	 * @param deltaMax The maximum permissible change of the output value.
+	 */
+	PidControllerFixed(double kp, double ki, double kd, double sampleTime, Q yMin, Q yMax, Q setpoint = Q(), Q yStart = Q(), Q deltaMax = Q::max());
+	explicit PidControllerFixed(const PidControllerFixed& other) = delete;
+	virtual ~PidControllerFixed() = default;
+
+	/**
+	 * @brief Set the proportional gain.
+	 * @param kp The new gain
+	 */
+	void setKp(double kp);
+	/**
+	 * @brief Returns the proportional gain.
+	 * @return The proportional gain.
+	 */
+	double kp() const;
+	/**
+	 * @brief Set the gain of the integral.
+	 * @param ki The new gain.
+	 */
+	void setKi(double ki);
+	/**
+	 * @brief Get the gain of the integral.
+	 * @return The gain.
+	 */
+	double ki() const;
+	/**
+	 * @brief Set the gain of the derivative.
+	 * @param kd The new gain.
+	 */
+	void setKd(double kd);
+	/**
+	 * @brief Returns the gain of the derivative.
+	 * @return The gain of the derivative.
+	 */
+	double kd() const;
+	/**
+	 * @brief Set the sample time of the controller.
+	 * @param sampleTime The sample time.
+	 */
+	void setSampleTime(double sampleTime);
+	/**
+	 * @brief Returns the current configured sample time.
+	 * @return The sample time.
+	 */
+	double sampleTime() const;
+	/**
+	 * @brief Set the controller set point.
+	 * @param setpoint The set point.
+	 */
+	void setSetpoint(Q setpoint);
+	/**
+	 * @brief Returns the current set point.
+	 * @return The current set point.
+	 */
+	Q setpoint() const;
+	/**
+	 * @brief Limits the maximum value of the output.
+	 * @param max The maximum value of the output.
+	 */
+	void setMaxOutput(Q max);
+	/**
+	 * @brief Returns the maximum value which the output is allowed to have.
+	 * @return The maximum limit of the output.
+	 */
+	Q maxOutput() const;
+	/**
+	 * @brief Set the minimum possible output.
+	 * @param min The minimum possible output.
+	 */
+	void setMinOutput(Q min);
+	/**
+	 * @brief Returns the minimum possible output.
+	 * @return The minimum possible output.
+	 */
+	Q minOutput() const;
+	/**
+	 * @brief Set the max delta of the output between two samples.
+	 * @param delta The max delta of the output.
+	 */
+	void setMaxDelta(Q delta);
+	/**
+	 * @brief Returns Set the max delta of the output between two samples.
+	 * @return The max delta of the output.
+	 */
+	Q maxDelta() const;
+	/**
+	 * @brief Resets the past sampled values which will be used
+	 * for the calculation of the integral and derivative.
+	 * @param yStart The start value for the integral (should 0 of no integral is used).
+	 */
+	void reset(Q yStart = Q());
+	/**
+	 * @brief Calculates the output value dependent to the actual value.
+	 * This method must be called cyclically at the interval of the set sampling time.
+	 * @param currentValue The current value.
+	 * @return The new output value of the controller (the input to the plant).
+	 */
+	virtual Q calculate(Q currentValue);
+
+private:
+	/**Type of the coefficients.*/
+	typedef int32_t Coefficient;
+	/**Type for the sum of the products of the coefficients and the control errors.*/
+	typedef int64_t Accumulator;
+
+	/**Maximum number of fraction bits of the coefficients, keeps the shift of \c Accumulator defined.*/
+	static constexpr uint8_t kMaxFractionBits = 62;
+
+	/** Calculate the coefficients q0, q1 and q2 and their fraction bits dependent on Kp, Ki, Kd and the sampleTime.*/
+	void calculateCoefficients();
+
+	double m_kp;         /**<Current Kp.*/
+	double m_ki;         /**<Current Ki.*/
+	double m_kd;         /**<Current Kd.*/
+	double m_sampleTime; /**< Sample time in seconds.*/
+	Coefficient m_q0 = 0;        /**< (Kp+Ki*smapleTime+(Kd/sampleTime)) * 2^m_fractionBits */
+	Coefficient m_q1 = 0;        /**< (-Kp-2*(Kd/sampleTime)) * 2^m_fractionBits */
+	Coefficient m_q2 = 0;        /**< (Kd/sampleTime) * 2^m_fractionBits */
+	uint8_t m_fractionBits = 0;  /**< Number of fraction bits of the coefficients.*/
+	Q m_yMin;            /**< The mininmum output value.*/
+	Q m_yMax;            /**< The maximum output value.*/
+	Q m_deltaMax;        /**< The maximum change limit of the output.*/
+	Q m_setpoint;        /**< The value on which the output is regulated.*/
+	Q m_yLast1;          /**< y(n-1)*/
+	Q m_eLast1;          /**< e(n-1)*/
+	Q m_eLast2;          /**< e(n-2)*/
+	Accumulator m_remainder = 0; /**< Bits of the output change below the output resolution.*/
+};
+
+template <typename Q>
+PidControllerFixed<Q>::PidControllerFixed(double kp, double ki, double kd, double sampleTime, Q yMin, Q yMax, Q setpoint, Q yStart, Q deltaMax)
+: m_kp(kp),
+  m_ki(ki),
+  m_kd(kd),
+  m_sampleTime(sampleTime),
+  m_yMin(yMin),
+  m_yMax(yMax),
+  m_deltaMax(deltaMax),
+  m_setpoint(setpoint)
+{
+	calculateCoefficients();
+	reset(yStart);
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setKp(double kp)
+{
+	SEMF_INFO("set kp to: %f", kp);
+	m_kp = kp;
+	calculateCoefficients();
+}
+
+template <typename Q>
+double PidControllerFixed<Q>::kp() const
+{
+	return m_kp;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setKi(double ki)
+{
+	SEMF_INFO("set ki to: %f", ki);
+	m_ki = ki;
+	calculateCoefficients();
+}
+
+template <typename Q>
+double PidControllerFixed<Q>::ki() const
+{
+	return m_ki;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setKd(double kd)
+{
+	SEMF_INFO("set kd to: %f", kd);
+	m_kd = kd;
+	calculateCoefficients();
+}
+
+template <typename Q>
+double PidControllerFixed<Q>::kd() const
+{
+	return m_kd;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setSampleTime(double sampleTime)
+{
+	SEMF_INFO("set sample time to: %f", sampleTime);
+	m_sampleTime = sampleTime;
+	calculateCoefficients();
+}
+
+template <typename Q>
+double PidControllerFixed<Q>::sampleTime() const
+{
+	return m_sampleTime;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setSetpoint(Q setpoint)
+{
+	SEMF_INFO("set setpoint to raw: %d", static_cast<int>(setpoint.raw()));
+	m_setpoint = setpoint;
+}
+
+template <typename Q>
+Q PidControllerFixed<Q>::setpoint() const
+{
+	return m_setpoint;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setMaxOutput(Q max)
+{
+	SEMF_INFO("set max output to raw: %d", static_cast<int>(max.raw()));
+	m_yMax = max;
+}
+
+template <typename Q>
+Q PidControllerFixed<Q>::maxOutput() const
+{
+	return m_yMax;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setMinOutput(Q min)
+{
+	SEMF_INFO("set min output to raw: %d", static_cast<int>(min.raw()));
+	m_yMin = min;
+}
+
+template <typename Q>
+Q PidControllerFixed<Q>::minOutput() const
+{
+	return m_yMin;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::setMaxDelta(Q delta)
+{
+	SEMF_INFO("set max delta to raw: %d", static_cast<int>(delta.raw()));
+	m_deltaMax = delta;
+}
+
+template <typename Q>
+Q PidControllerFixed<Q>::maxDelta() const
+{
+	return m_deltaMax;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::reset(Q yStart)
+{
+	SEMF_INFO("to yStart raw: %d", static_cast<int>(yStart.raw()));
+	// if m_ki>0 init the integral with the start value
+	if (m_ki != 0)
+		m_yLast1 = yStart;
+	else
+		m_yLast1 = Q();
+	m_eLast1 = Q();
+	m_eLast2 = Q();
+	m_remainder = 0;
+}
+
+template <typename Q>
+Q PidControllerFixed<Q>::calculate(Q currentValue)
+{
+	Q e = m_setpoint - currentValue;
+
+	// the sum of the absolute coefficients fits into 32 bit and the errors into Q, so the sum of the products
+	// fits into 64 bit
+	Accumulator sum = static_cast<Accumulator>(m_q0) * e.raw() + static_cast<Accumulator>(m_q1) * m_eLast1.raw() +
+					  static_cast<Accumulator>(m_q2) * m_eLast2.raw();
+	// the bits shifted out are kept for the next sample, so changes smaller than one bit of the output are not lost
+	sum += m_remainder;
+	Accumulator delta = sum >> m_fractionBits;
+	m_remainder = sum - delta * (static_cast<Accumulator>(1) << m_fractionBits);
+	Accumulator y = static_cast<Accumulator>(m_yLast1.raw()) + delta;
+
+	// limit the min and max value of the output
+	if (y > m_yMax.raw())
+		y = m_yMax.raw();
+	else if (y < m_yMin.raw())
+		y = m_yMin.raw();
+
+	// limit the delta from the output
+	if ((y - m_yLast1.raw()) > m_deltaMax.raw())
+		y = static_cast<Accumulator>(m_yLast1.raw()) + m_deltaMax.raw();
+	else if ((m_yLast1.raw() - y) > m_deltaMax.raw())
+		y = static_cast<Accumulator>(m_yLast1.raw()) - m_deltaMax.raw();
+
+	if (y != static_cast<Accumulator>(m_yLast1.raw()) + delta)
+		m_remainder = 0;
+
+	m_yLast1 = Q::fromRaw(static_cast<typename Q::Raw>(y));
+	m_eLast2 = m_eLast1;
+	m_eLast1 = e;
+	return m_yLast1;
+}
+
+template <typename Q>
+void PidControllerFixed<Q>::calculateCoefficients()
+{
+	double q0 = m_kp + m_ki * m_sampleTime + (m_kd / m_sampleTime);
+	double q1 = -m_kp - 2 * m_kd / m_sampleTime;
+	double q2 = m_kd / m_sampleTime;
+
+	double sum = std::fabs(q0) + std::fabs(q1) + std::fabs(q2);
+	if (!std::isfinite(sum))
+	{
+		SEMF_ERROR("coefficients are not finite, sample time: %f", m_sampleTime);
+		m_q0 = 0;
+		m_q1 = 0;
+		m_q2 = 0;
+		m_fractionBits = 0;
+		return;
+	}
+
+	// each of the three coefficients is rounded by up to one half, so the limit keeps space for the rounding
+	const double limit = static_cast<double>(std::numeric_limits<Coefficient>::max() - 2);
+	if (sum > limit)
+	{
+		SEMF_ERROR("coefficients too big, reduced by %f", sum / limit);
+		q0 *= limit / sum;
+		q1 *= limit / sum;
+		q2 *= limit / sum;
+		sum = limit;
+	}
+	double factor = 1;
+	m_fractionBits = 0;
+	while (sum * factor * 2 <= limit && m_fractionBits < kMaxFractionBits)
+	{
+		factor *= 2;
+		m_fractionBits++;
+	}
+	// a remainder of the previous fraction bits would be a wrong output change
+	m_remainder = 0;
+
+	m_q1 = static_cast<Coefficient>(std::lround(q1 * factor));
+	m_q2 = static_cast<Coefficient>(std::lround(q2 * factor));
+	// q0 + q1 + q2 is the integral gain Ki * sampleTime, so q0 is chosen to keep this sum exact after rounding,
+	// otherwise the rounding errors of the three coefficients would add up in the integral
+	Accumulator integral = std::llround((q0 + q1 + q2) * factor);
+	m_q0 = static_cast<Coefficient>(integral - m_q1 - m_q2);
+	SEMF_INFO("q0: %f, q1: %f, q2: %f, fraction bits: %u", q0, q1, q2, m_fractionBits);
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_PIDCONTROLLERFIXED_H_ */
@@ -0,0 +1,374 @@
+/**
+ * @file reedsolomon.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_REEDSOLOMON_H_
+#define SEMF_UTILS_PROCESSING_REEDSOLOMON_H_
+
+#include <semf/app/processing/errorcorrectioncode.h>
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/galoisfield256.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace semf
+{
+/**
+ * @brief Reed-Solomon error correction code over GF(256).
+ *
+ * The data is split into blocks of <tt>BLOCK_SIZE - PARITY</tt> bytes, each followed by \c PARITY parity bytes.
+ * The last block can be shorter. Per block up to <tt>PARITY / 2</tt> wrong bytes are corrected. If the positions
+ * of wrong bytes are known (erasures, e.g. from a failed flash page read or a framing error), \c decodeBlock()
+ * corrects <tt>2 * errors + erasures <= PARITY</tt>.
+ *
+ * Decoding calculates the syndromes, the error locator with the Berlekamp-Massey algorithm, the error positions
+ * with a Chien search and the error values with the Forney algorithm. All working memory is sized by the template
+ * parameters and placed on the stack, no memory is allocated.
+ *
+ * @note Data sizes are given in bits and buffer sizes in bytes, the data is processed in whole bytes.
+ * @param PARITY Number of parity bytes per block.
+ * @param BLOCK_SIZE Number of bytes per block including the parity bytes, at most 255.
+ */
+template <size_t PARITY, size_t BLOCK_SIZE = 255>
+class ReedSolomon : public app::ErrorCorrectionCode
+{
+	static_assert(PARITY > 0 && PARITY < BLOCK_SIZE && BLOCK_SIZE <= 255, "PARITY and BLOCK_SIZE do not fit into GF(256)");
+
+public:
+	/**
+	 * @brief Error codes for this class. Error ID identify a unique error() / onError call (excluding transferring).
+	 */
+	enum class ErrorCode : uint8_t
+	{
+		Decode_Uncorrectable = 0
+	};
+
+	/**Number of data bytes of a whole block.*/
+	static constexpr size_t kDataSize = BLOCK_SIZE - PARITY;
+
+	ReedSolomon() = default;
+	explicit ReedSolomon(const ReedSolomon& other) = delete;
+	virtual ~ReedSolomon() = default;
+
+	/**
+	 * @copydoc app::ErrorCorrectionCode::encode()
+	 * @note \c data and \c buffer can be the same array for encoding in place, other overlaps are not supported.
+	 * @return The number of bits that have been written into the buffer, zero if the buffer is too small.
+	 */
+	size_t encode(const uint8_t data[], size_t dataBitSize, uint8_t buffer[], size_t bufferSize) const override;
+	/**
+	 * @copydoc app::ErrorCorrectionCode::decode()
+	 * @note \c data and \c buffer can be the same array for decoding in place, other overlaps are not supported.
+	 * @return The number of bits that have been written into the buffer, zero if the buffer is too small.
+	 * @throws Decode_Uncorrectable For every block with too many errors, the block is copied uncorrected.
+	 */
+	size_t decode(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize) const override;
+	size_t blockBitSize(size_t messageBitSize) const override;
+	/**
+	 * @brief Corrects a single block in place.
+	 * @param block Block with data and parity bytes.
+	 * @param blockSize Size of the block in bytes, between <tt>PARITY + 1</tt> and \c BLOCK_SIZE.
+	 * @param erasures Indexes of the bytes in \c block known to be wrong, can be \c nullptr if \c erasureCount is zero.
+	 * @param erasureCount Number of erasures, at most \c PARITY.
+	 * @return \c true if the block is valid or was corrected, \c false if it is uncorrectable.
+	 * @throws Decode_Uncorrectable If the block is uncorrectable, the block is left unchanged.
+	 */
+	bool decodeBlock(uint8_t block[], size_t blockSize, const size_t erasures[] = nullptr, size_t erasureCount = 0) const;
+
+private:
+	/**Generator polynomial with the coefficient of x^PARITY first (always one) and the constant last.*/
+	struct Generator
+	{
+		/**Coefficients.*/
+		uint8_t coefficients[PARITY + 1];
+	};
+	/**
+	 * @brief Calculates the generator polynomial (x - alpha^0) * ... * (x - alpha^(PARITY - 1)).
+	 * @return Generator polynomial.
+	 */
+	static constexpr Generator generateGenerator();
+	/**
+	 * @brief Multiplies two elements, usable at compile time.
+	 * @param a First factor.
+	 * @param b Second factor.
+	 * @return Product.
+	 */
+	static constexpr uint8_t multiply(uint8_t a, uint8_t b);
+	/**
+	 * @brief Calculates the parity bytes of a block.
+	 * @param data Data bytes.
+	 * @param dataSize Number of data bytes.
+	 * @param parity Buffer for \c PARITY parity bytes.
+	 */
+	static void encodeBlock(const uint8_t data[], size_t dataSize, uint8_t parity[]);
+
+	/**Generator polynomial calculated at compile time.*/
+	static constexpr Generator kGenerator = generateGenerator();
+	/**Class ID for error tracing.*/
+	static constexpr Error::ClassID kSemfClassId = Error::ClassID::ReedSolomon;
+};
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+size_t ReedSolomon<PARITY, BLOCK_SIZE>::encode(const uint8_t data[], size_t dataBitSize, uint8_t buffer[], size_t bufferSize) const
+{
+	size_t bits = blockBitSize(dataBitSize);
+	if (bufferSize * 8 < bits)
+	{
+		SEMF_ERROR("buffer size %u too small", bufferSize);
+		return 0;
+	}
+
+	size_t dataSize = (dataBitSize + 7) / 8;
+	size_t blocks = (dataSize + kDataSize - 1) / kDataSize;
+	// Starting with the last block, every block is written behind the data not encoded yet, so in place works.
+	for (size_t block = blocks; block > 0; block--)
+	{
+		size_t pos = (block - 1) * kDataSize;
+		size_t size = dataSize - pos < kDataSize ? dataSize - pos : kDataSize;
+		uint8_t* output = &buffer[(block - 1) * BLOCK_SIZE];
+		std::memmove(output, &data[pos], size);
+		encodeBlock(output, size, &output[size]);
+	}
+	SEMF_INFO("encoded %u bits", bits);
+	return bits;
+}
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+size_t ReedSolomon<PARITY, BLOCK_SIZE>::decode(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize) const
+{
+	dataSize /= 8;
+	size_t blocks = (dataSize + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	if (blocks > 0 && dataSize - (blocks - 1) * BLOCK_SIZE <= PARITY)
+	{
+		SEMF_ERROR("last block has no data");
+		return 0;
+	}
+	size_t messageSize = dataSize - blocks * PARITY;
+	if (bufferSize < messageSize)
+	{
+		SEMF_ERROR("buffer size %u too small", bufferSize);
+		return 0;
+	}
+
+	uint8_t block[BLOCK_SIZE];
+	for (size_t pos = 0; pos < dataSize; pos += BLOCK_SIZE)
+	{
+		size_t size = dataSize - pos < BLOCK_SIZE ? dataSize - pos : BLOCK_SIZE;
+		std::memcpy(block, &data[pos], size);
+		decodeBlock(block, size);
+		std::memcpy(buffer, block, size - PARITY);
+		buffer += size - PARITY;
+	}
+	SEMF_INFO("decoded %u blocks", blocks);
+	return messageSize * 8;
+}
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+size_t ReedSolomon<PARITY, BLOCK_SIZE>::blockBitSize(size_t messageBitSize) const
+{
+	size_t messageSize = (messageBitSize + 7) / 8;
+	size_t blocks = (messageSize + kDataSize - 1) / kDataSize;
+	return (messageSize + blocks * PARITY) * 8;
+}
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+bool ReedSolomon<PARITY, BLOCK_SIZE>::decodeBlock(uint8_t block[], size_t blockSize, const size_t erasures[], size_t erasureCount) const
+{
+	using Gf = GaloisField256;
+
+	if (blockSize <= PARITY || blockSize > BLOCK_SIZE || erasureCount > PARITY)
+	{
+		SEMF_ERROR("invalid block size %u or erasure count %u", blockSize, erasureCount);
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_Uncorrectable)));
+		return false;
+	}
+
+	// Syndromes S_j = r(alpha^j), byte i of the block is the coefficient of x^(blockSize - 1 - i).
+	uint8_t syndromes[PARITY];
+	bool valid = true;
+	for (size_t j = 0; j < PARITY; j++)
+	{
+		uint8_t root = Gf::power(j);
+		uint8_t sum = 0;
+		for (size_t i = 0; i < blockSize; i++)
+			sum = Gf::multiply(sum, root) ^ block[i];
+		syndromes[j] = sum;
+		valid &= sum == 0;
+	}
+	if (valid)
+		return true;
+
+	// Errata locator starts with the erasure locator, Berlekamp-Massey adds the unknown errors.
+	uint8_t locator[PARITY + 1] = {1};
+	uint8_t previous[PARITY + 1] = {1};
+	uint8_t temp[PARITY + 1];
+	for (size_t k = 0; k < erasureCount; k++)
+	{
+		if (erasures[k] >= blockSize)
+		{
+			SEMF_ERROR("erasure %u outside of block", erasures[k]);
+			error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_Uncorrectable)));
+			return false;
+		}
+		uint8_t locatorValue = Gf::power(blockSize - 1 - erasures[k]);
+		for (size_t i = k + 1; i > 0; i--)
+			locator[i] ^= Gf::multiply(locator[i - 1], locatorValue);
+	}
+	std::memcpy(previous, locator, sizeof(locator));
+
+	size_t length = erasureCount;
+	for (size_t r = erasureCount + 1; r <= PARITY; r++)
+	{
+		uint8_t discrepancy = 0;
+		for (size_t i = 0; i <= length && i < r; i++)
+			discrepancy ^= Gf::multiply(locator[i], syndromes[r - 1 - i]);
+
+		// previous = x * previous
+		for (size_t i = PARITY; i > 0; i--)
+			previous[i] = previous[i - 1];
+		previous[0] = 0;
+		if (discrepancy == 0)
+			continue;
+
+		std::memcpy(temp, locator, sizeof(locator));
+		for (size_t i = 0; i <= PARITY; i++)
+			locator[i] ^= Gf::multiply(discrepancy, previous[i]);
+		if (2 * length <= r + erasureCount - 1)
+		{
+			length = r + erasureCount - length;
+			for (size_t i = 0; i <= PARITY; i++)
+				previous[i] = Gf::divide(temp[i], discrepancy);
+		}
+	}
+
+	size_t degree = PARITY;
+	while (degree > 0 && locator[degree] == 0)
+		degree--;
+	if (degree != length || 2 * length - erasureCount > PARITY)
+	{
+		SEMF_ERROR("uncorrectable block");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_Uncorrectable)));
+		return false;
+	}
+
+	// Errata evaluator omega = S * locator mod x^PARITY.
+	uint8_t evaluator[PARITY];
+	for (size_t i = 0; i < PARITY; i++)
+	{
+		uint8_t sum = 0;
+		for (size_t j = 0; j <= i && j <= degree; j++)
+			sum ^= Gf::multiply(locator[j], syndromes[i - j]);
+		evaluator[i] = sum;
+	}
+
+	// Chien search over the positions of the block, the corrections are collected before changing the block.
+	size_t positions[PARITY];
+	uint8_t values[PARITY];
+	size_t found = 0;
+	for (size_t i = 0; i < blockSize && found < degree; i++)
+	{
+		size_t power = blockSize - 1 - i;
+		uint8_t inverse = Gf::power(255 - power % 255);
+		uint8_t sum = 0;
+		uint8_t x = 1;
+		for (size_t j = 0; j <= degree; j++)
+		{
+			sum ^= Gf::multiply(locator[j], x);
+			x = Gf::multiply(x, inverse);
+		}
+		if (sum != 0)
+			continue;
+
+		// Forney: value = X * omega(X^-1) / locator'(X^-1), the derivative only keeps the odd coefficients.
+		uint8_t numerator = 0;
+		x = 1;
+		for (size_t j = 0; j < PARITY; j++)
+		{
+			numerator ^= Gf::multiply(evaluator[j], x);
+			x = Gf::multiply(x, inverse);
+		}
+		uint8_t denominator = 0;
+		x = 1;
+		uint8_t inverseSquare = Gf::multiply(inverse, inverse);
+		for (size_t j = 1; j <= degree; j += 2)
+		{
+			denominator ^= Gf::multiply(locator[j], x);
+			x = Gf::multiply(x, inverseSquare);
+		}
+		if (denominator == 0)
+			break;
+		positions[found] = i;
+		values[found] = Gf::multiply(Gf::power(power), Gf::divide(numerator, denominator));
+		found++;
+	}
+	if (found != degree)
+	{
+		SEMF_ERROR("uncorrectable block");
+		error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_Uncorrectable)));
+		return false;
+	}
+
+	for (size_t k = 0; k < found; k++)
+		block[positions[k]] ^= values[k];
+	SEMF_INFO("corrected %u bytes", found);
+	return true;
+}
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+constexpr uint8_t ReedSolomon<PARITY, BLOCK_SIZE>::multiply(uint8_t a, uint8_t b)
+{
+	unsigned int product = 0;
+	unsigned int factor = a;
+	while (b != 0)
+	{
+		if (b & 1)
+			product ^= factor;
+		factor <<= 1;
+		if (factor & 0x100)
+			factor ^= 0x11d;
+		b >>= 1;
+	}
+	return static_cast<uint8_t>(product);
+}
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+constexpr typename ReedSolomon<PARITY, BLOCK_SIZE>::Generator ReedSolomon<PARITY, BLOCK_SIZE>::generateGenerator()
+{
+	Generator generator = {};
+	generator.coefficients[0] = 1;
+	uint8_t root = 1;
+	for (size_t j = 0; j < PARITY; j++)
+	{
+		// Multiplying with (x - alpha^j), the new constant is appended at index j + 1.
+		for (size_t i = j + 1; i > 0; i--)
+			generator.coefficients[i] ^= multiply(generator.coefficients[i - 1], root);
+		root = multiply(root, 2);
+	}
+	return generator;
+}
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+constexpr typename ReedSolomon<PARITY, BLOCK_SIZE>::Generator ReedSolomon<PARITY, BLOCK_SIZE>::kGenerator;
+
+template <size_t PARITY, size_t BLOCK_SIZE>
+void ReedSolomon<PARITY, BLOCK_SIZE>::encodeBlock(const uint8_t data[], size_t dataSize, uint8_t parity[])
+{
+	// Division by the generator polynomial with a shift register, the remainder are the parity bytes.
+	uint8_t remainder[PARITY] = {0};
+	for (size_t i = 0; i < dataSize; i++)
+	{
+		uint8_t feedback = data[i] ^ remainder[0];
+		for (size_t j = 0; j + 1 < PARITY; j++)
+			remainder[j] = remainder[j + 1] ^ GaloisField256::multiply(feedback, kGenerator.coefficients[j + 1]);
+		remainder[PARITY - 1] = GaloisField256::multiply(feedback, kGenerator.coefficients[PARITY]);
+	}
+	std::memcpy(parity, remainder, PARITY);
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_REEDSOLOMON_H_ */
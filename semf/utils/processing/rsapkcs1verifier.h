@@ -0,0 +1,323 @@
+/**
+ * @file rsapkcs1verifier.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_RSAPKCS1VERIFIER_H_
+#define SEMF_UTILS_PROCESSING_RSAPKCS1VERIFIER_H_
+
+#include <semf/app/processing/signaturepkcs1.h>
+#include <semf/utils/core/debug.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace semf
+{
+/**
+ * @brief RSA PKCS#1 v1.5 signature verification in software.
+ *
+ * The modular exponentiation uses Montgomery multiplication on 32 bit words, so no division is needed.
+ * All numbers have a fixed size given by \c KEY_BITS and are members of the object, so no memory is allocated.
+ * The Montgomery constants are calculated once in \c setPublicKey().
+ *
+ * The exponentiation only processes the bits of the public exponent, so the common exponent 65537 needs 17
+ * Montgomery multiplications (16 squarings and one multiplication) plus the conversions.
+ *
+ * @note Only verification is supported, \c setPrivateKey() and \c sign() always return \c State::Error.
+ * @note The public exponent must not be bigger than 32 bits.
+ * @param KEY_BITS Size of the modulus in bits, e.g. 2048 or 3072.
+ */
+template <size_t KEY_BITS>
+class RsaPkcs1Verifier : public app::SignaturePkcs1
+{
+	static_assert(KEY_BITS % 32 == 0 && KEY_BITS >= 512, "KEY_BITS has to be a multiple of 32 and at least 512");
+
+public:
+	/**Size of the modulus and the signature in bytes.*/
+	static constexpr size_t kKeySize = KEY_BITS / 8;
+
+	RsaPkcs1Verifier() = default;
+	explicit RsaPkcs1Verifier(const RsaPkcs1Verifier& other) = delete;
+	virtual ~RsaPkcs1Verifier() = default;
+
+	/**
+	 * @copydoc app::SignaturePkcs1::setPublicKey()
+	 * @note \c nLen has to be \c kKeySize, the modulus has to be odd and \c eLen must not be bigger than four.
+	 */
+	State setPublicKey(const uint8_t n[], size_t nLen, const uint8_t e[], size_t eLen) override;
+	State setPrivateKey(const uint8_t n[], size_t nLen, const uint8_t d[], size_t dLen) override;
+	State sign(const uint8_t hashDigest[], size_t hashBitLen, uint8_t sign[], HashAlgorithm hashAlgorithm) override;
+	/**
+	 * @copydoc app::SignaturePkcs1::verify()
+	 * @note \c sign has to be \c kKeySize bytes.
+	 */
+	State verify(const uint8_t hashDigest[], size_t hashBitLen, const uint8_t sign[], HashAlgorithm hashAlgorithm) override;
+
+private:
+	/**Number of 32 bit words of a number.*/
+	static constexpr size_t kWords = KEY_BITS / 32;
+
+	/**
+	 * @brief Converts a big endian byte array into words with the least significant word first.
+	 * @param number Number to store the result in.
+	 * @param data Big endian bytes, \c kKeySize bytes.
+	 */
+	static void load(uint32_t number[], const uint8_t data[]);
+	/**
+	 * @brief Converts words with the least significant word first into a big endian byte array.
+	 * @param data Buffer for big endian bytes, \c kKeySize bytes.
+	 * @param number Number to convert.
+	 */
+	static void store(uint8_t data[], const uint32_t number[]);
+	/**
+	 * @brief Compares two numbers.
+	 * @param a First number.
+	 * @param b Second number.
+	 * @return \c true if \c a is bigger or equal \c b, \c false otherwise.
+	 */
+	static bool isGreaterEqual(const uint32_t a[], const uint32_t b[]);
+	/**
+	 * @brief Subtracts \c b from \c a in place.
+	 * @param a Minuend and difference.
+	 * @param b Subtrahend.
+	 * @return Borrow.
+	 */
+	static uint32_t subtract(uint32_t a[], const uint32_t b[]);
+	/**
+	 * @brief Calculates a * b * R^-1 mod N with R = 2^KEY_BITS (Montgomery multiplication, CIOS method).
+	 * @param result Number to store the product in, can not be \c a or \c b.
+	 * @param a First factor, smaller than N.
+	 * @param b Second factor, smaller than N.
+	 */
+	void multiply(uint32_t result[], const uint32_t a[], const uint32_t b[]) const;
+
+	/**Modulus N.*/
+	uint32_t m_modulus[kWords];
+	/**R^2 mod N for converting into Montgomery representation.*/
+	uint32_t m_rSquare[kWords];
+	/**-N^-1 mod 2^32.*/
+	uint32_t m_modulusInverse = 0;
+	/**Public exponent, zero if no key is set.*/
+	uint32_t m_exponent = 0;
+	/**Working numbers for the exponentiation.*/
+	uint32_t m_work[3][kWords];
+};
+
+template <size_t KEY_BITS>
+typename RsaPkcs1Verifier<KEY_BITS>::State RsaPkcs1Verifier<KEY_BITS>::setPublicKey(const uint8_t n[], size_t nLen, const uint8_t e[],
+																					  size_t eLen)
+{
+	m_exponent = 0;
+	if (nLen != kKeySize || eLen == 0 || eLen > 4 || (n[nLen - 1] & 1) == 0)
+	{
+		SEMF_ERROR("invalid key: nLen %u, eLen %u", nLen, eLen);
+		return State::Error;
+	}
+
+	load(m_modulus, n);
+	uint32_t exponent = 0;
+	for (size_t i = 0; i < eLen; i++)
+		exponent = (exponent << 8) | e[i];
+
+	// Newton iteration doubles the number of correct bits in each step: 1 -> 2 -> 4 -> 8 -> 16 -> 32.
+	uint32_t inverse = 1;
+	for (int i = 0; i < 5; i++)
+		inverse *= 2 - m_modulus[0] * inverse;
+	m_modulusInverse = 0 - inverse;
+
+	// R^2 mod N by doubling one 2 * KEY_BITS times with modular reduction.
+	std::memset(m_rSquare, 0, sizeof(m_rSquare));
+	m_rSquare[0] = 1;
+	for (size_t bit = 0; bit < 2 * KEY_BITS; bit++)
+	{
+		uint32_t carry = 0;
+		for (size_t i = 0; i < kWords; i++)
+		{
+			uint32_t word = m_rSquare[i];
+			m_rSquare[i] = (word << 1) | carry;
+			carry = word >> 31;
+		}
+		if (carry != 0 || isGreaterEqual(m_rSquare, m_modulus))
+			subtract(m_rSquare, m_modulus);
+	}
+
+	m_exponent = exponent;
+	SEMF_INFO("public key set");
+	return State::Ok;
+}
+
+template <size_t KEY_BITS>
+typename RsaPkcs1Verifier<KEY_BITS>::State RsaPkcs1Verifier<KEY_BITS>::setPrivateKey(const uint8_t n[], size_t nLen, const uint8_t d[],
+																					   size_t dLen)
+{
+	(void)n;
+	(void)nLen;
+	(void)d;
+	(void)dLen;
+	SEMF_ERROR("signing is not supported");
+	return State::Error;
+}
+
+template <size_t KEY_BITS>
+typename RsaPkcs1Verifier<KEY_BITS>::State RsaPkcs1Verifier<KEY_BITS>::sign(const uint8_t hashDigest[], size_t hashBitLen, uint8_t sign[],
+																			  HashAlgorithm hashAlgorithm)
+{
+	(void)hashDigest;
+	(void)hashBitLen;
+	(void)sign;
+	(void)hashAlgorithm;
+	SEMF_ERROR("signing is not supported");
+	return State::Error;
+}
+
+template <size_t KEY_BITS>
+typename RsaPkcs1Verifier<KEY_BITS>::State RsaPkcs1Verifier<KEY_BITS>::verify(const uint8_t hashDigest[], size_t hashBitLen,
+																				const uint8_t sign[], HashAlgorithm hashAlgorithm)
+{
+	// DER encoded DigestInfo prefixes from RFC 8017.
+	static const uint8_t sha256Prefix[] = {0x30, 0x31, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+										   0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20};
+	static const uint8_t md5Prefix[] = {0x30, 0x20, 0x30, 0x0c, 0x06, 0x08, 0x2a, 0x86, 0x48,
+										0x86, 0xf7, 0x0d, 0x02, 0x05, 0x05, 0x00, 0x04, 0x10};
+	const uint8_t* prefix = hashAlgorithm == HashAlgorithm::Sha256 ? sha256Prefix : md5Prefix;
+	size_t prefixSize = hashAlgorithm == HashAlgorithm::Sha256 ? sizeof(sha256Prefix) : sizeof(md5Prefix);
+	size_t hashSize = hashAlgorithm == HashAlgorithm::Sha256 ? 32 : 16;
+
+	if (m_exponent == 0 || hashBitLen != hashSize * 8)
+	{
+		SEMF_ERROR("no public key set or invalid hash size %u", hashBitLen);
+		return State::Error;
+	}
+
+	uint32_t* message = m_work[0];
+	uint32_t* power = m_work[1];
+	uint32_t* temp = m_work[2];
+	load(message, sign);
+	if (isGreaterEqual(message, m_modulus))
+	{
+		SEMF_ERROR("signature is not smaller than the modulus");
+		return State::Error;
+	}
+
+	// Square and multiply from the most significant exponent bit in Montgomery representation.
+	multiply(temp, message, m_rSquare);
+	std::memcpy(message, temp, sizeof(m_work[0]));
+	std::memcpy(power, message, sizeof(m_work[0]));
+	int bit = 31;
+	while (((m_exponent >> bit) & 1) == 0)
+		bit--;
+	for (bit--; bit >= 0; bit--)
+	{
+		multiply(temp, power, power);
+		if ((m_exponent >> bit) & 1)
+			multiply(power, temp, message);
+		else
+			std::memcpy(power, temp, sizeof(m_work[0]));
+	}
+	// Converting back by multiplying with one.
+	std::memset(message, 0, sizeof(m_work[0]));
+	message[0] = 1;
+	multiply(temp, power, message);
+
+	// Checking the encoded message 0x00 0x01 0xff ... 0xff 0x00 DigestInfo hash in place of the number.
+	uint8_t* encoded = reinterpret_cast<uint8_t*>(power);
+	store(encoded, temp);
+	size_t paddingEnd = kKeySize - hashSize - prefixSize - 1;
+	bool valid = encoded[0] == 0x00 && encoded[1] == 0x01 && encoded[paddingEnd] == 0x00;
+	for (size_t i = 2; i < paddingEnd; i++)
+		valid &= encoded[i] == 0xff;
+	valid &= std::memcmp(&encoded[paddingEnd + 1], prefix, prefixSize) == 0;
+	valid &= std::memcmp(&encoded[kKeySize - hashSize], hashDigest, hashSize) == 0;
+
+	SEMF_INFO("signature valid: %d", valid);
+	return valid ? State::Ok : State::Error;
+}
+
+template <size_t KEY_BITS>
+void RsaPkcs1Verifier<KEY_BITS>::load(uint32_t number[], const uint8_t data[])
+{
+	for (size_t i = 0; i < kWords; i++)
+	{
+		const uint8_t* word = &data[kKeySize - 4 - i * 4];
+		number[i] = (static_cast<uint32_t>(word[0]) << 24) | (static_cast<uint32_t>(word[1]) << 16) | (static_cast<uint32_t>(word[2]) << 8) |
+					static_cast<uint32_t>(word[3]);
+	}
+}
+
+template <size_t KEY_BITS>
+void RsaPkcs1Verifier<KEY_BITS>::store(uint8_t data[], const uint32_t number[])
+{
+	for (size_t i = 0; i < kWords; i++)
+	{
+		uint8_t* word = &data[kKeySize - 4 - i * 4];
+		word[0] = static_cast<uint8_t>(number[i] >> 24);
+		word[1] = static_cast<uint8_t>(number[i] >> 16);
+		word[2] = static_cast<uint8_t>(number[i] >> 8);
+		word[3] = static_cast<uint8_t>(number[i]);
+	}
+}
+
+template <size_t KEY_BITS>
+bool RsaPkcs1Verifier<KEY_BITS>::isGreaterEqual(const uint32_t a[], const uint32_t b[])
+{
+	for (size_t i = kWords; i > 0; i--)
+	{
+		if (a[i - 1] != b[i - 1])
+			return a[i - 1] > b[i - 1];
+	}
+	return true;
+}
+
+template <size_t KEY_BITS>
+uint32_t RsaPkcs1Verifier<KEY_BITS>::subtract(uint32_t a[], const uint32_t b[])
+{
+	uint32_t borrow = 0;
+	for (size_t i = 0; i < kWords; i++)
+	{
+		uint64_t difference = static_cast<uint64_t>(a[i]) - b[i] - borrow;
+		a[i] = static_cast<uint32_t>(difference);
+		borrow = static_cast<uint32_t>(difference >> 63);
+	}
+	return borrow;
+}
+
+template <size_t KEY_BITS>
+void RsaPkcs1Verifier<KEY_BITS>::multiply(uint32_t result[], const uint32_t a[], const uint32_t b[]) const
+{
+	// result holds the lower words of the intermediate sum, the two upper words are kept separately.
+	std::memset(result, 0, kWords * sizeof(uint32_t));
+	uint32_t upper = 0;
+	for (size_t i = 0; i < kWords; i++)
+	{
+		uint64_t product = 0;
+		for (size_t j = 0; j < kWords; j++)
+		{
+			product = static_cast<uint64_t>(a[j]) * b[i] + result[j] + (product >> 32);
+			result[j] = static_cast<uint32_t>(product);
+		}
+		uint64_t sum = static_cast<uint64_t>(upper) + (product >> 32);
+		uint32_t top = static_cast<uint32_t>(sum >> 32);
+
+		// Adding a multiple of N, so the lowest word gets zero and the sum can be shifted by one word.
+		uint32_t factor = result[0] * m_modulusInverse;
+		product = static_cast<uint64_t>(factor) * m_modulus[0] + result[0];
+		for (size_t j = 1; j < kWords; j++)
+		{
+			product = static_cast<uint64_t>(factor) * m_modulus[j] + result[j] + (product >> 32);
+			result[j - 1] = static_cast<uint32_t>(product);
+		}
+		sum = (sum & 0xffffffff) + (product >> 32);
+		result[kWords - 1] = static_cast<uint32_t>(sum);
+		upper = top + static_cast<uint32_t>(sum >> 32);
+	}
+
+	if (upper != 0 || isGreaterEqual(result, m_modulus))
+		subtract(result, m_modulus);
+}
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_RSAPKCS1VERIFIER_H_ */
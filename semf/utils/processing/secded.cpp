@@ -0,0 +1,136 @@
+/**
+ * @file secded.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/secded.h>
+#include <cstring>
+
+namespace semf
+{
+constexpr Secded::Tables Secded::generateTables()
+{
+	Tables tables = {};
+	for (size_t i = 0; i < 128; i++)
+		tables.syndromes[i] = kNoDataBit;
+
+	// Every data bit gets a unique syndrome with at least two bits set, powers of two belong to the parity bits.
+	uint8_t syndrome = 3;
+	for (uint8_t bit = 0; bit < 64; bit++, syndrome++)
+	{
+		if ((syndrome & (syndrome - 1)) == 0)
+			syndrome++;
+		tables.syndromes[syndrome] = bit;
+		for (size_t i = 0; i < 7; i++)
+		{
+			if (syndrome & (1 << i))
+				tables.masks[i] |= static_cast<uint64_t>(1) << bit;
+		}
+	}
+	return tables;
+}
+
+const Secded::Tables Secded::kTables = Secded::generateTables();
+
+size_t Secded::encode(const uint8_t data[], size_t dataBitSize, uint8_t buffer[], size_t bufferSize) const
+{
+	size_t bits = blockBitSize(dataBitSize);
+	if (bufferSize * 8 < bits)
+	{
+		SEMF_ERROR("buffer size %u too small", bufferSize);
+		return 0;
+	}
+
+	size_t dataSize = (dataBitSize + 7) / 8;
+	for (size_t pos = 0; pos < dataSize; pos += kDataSize, buffer += kBlockSize)
+	{
+		size_t size = dataSize - pos < kDataSize ? dataSize - pos : kDataSize;
+		uint8_t block[kDataSize] = {0};
+		std::memcpy(block, &data[pos], size);
+		if (dataBitSize % 8 != 0 && pos + size == dataSize)
+			block[size - 1] &= static_cast<uint8_t>((1 << (dataBitSize % 8)) - 1);
+
+		uint64_t word = 0;
+		for (size_t i = 0; i < kDataSize; i++)
+			word |= static_cast<uint64_t>(block[i]) << (i * 8);
+		std::memcpy(buffer, block, kDataSize);
+		buffer[kDataSize] = check(word);
+	}
+	SEMF_INFO("encoded %u bits", bits);
+	return bits;
+}
+
+size_t Secded::decode(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize) const
+{
+	size_t blocks = dataSize / (kBlockSize * 8);
+	if (bufferSize < blocks * kDataSize)
+	{
+		SEMF_ERROR("buffer size %u too small", bufferSize);
+		return 0;
+	}
+
+	for (size_t block = 0; block < blocks; block++, data += kBlockSize, buffer += kDataSize)
+	{
+		uint64_t word = 0;
+		for (size_t i = 0; i < kDataSize; i++)
+			word |= static_cast<uint64_t>(data[i]) << (i * 8);
+
+		uint8_t difference = check(word) ^ data[kDataSize];
+		uint8_t syndrome = difference & 0x7f;
+		// The overall parity covers the parity bits too, so a single error always flips it.
+		bool overallError = (parity(syndrome) ^ (difference >> 7)) != 0;
+		if (syndrome != 0 && overallError)
+		{
+			uint8_t bit = kTables.syndromes[syndrome];
+			if (bit != kNoDataBit)
+			{
+				word ^= static_cast<uint64_t>(1) << bit;
+			}
+			else if ((syndrome & (syndrome - 1)) != 0)
+			{
+				SEMF_ERROR("uncorrectable block %u", block);
+				error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_Uncorrectable)));
+			}
+		}
+		else if (syndrome != 0)
+		{
+			SEMF_ERROR("uncorrectable block %u", block);
+			error(Error(kSemfClassId, static_cast<uint8_t>(ErrorCode::Decode_Uncorrectable)));
+		}
+
+		for (size_t i = 0; i < kDataSize; i++)
+			buffer[i] = static_cast<uint8_t>(word >> (i * 8));
+	}
+	SEMF_INFO("decoded %u blocks", blocks);
+	return blocks * kDataSize * 8;
+}
+
+size_t Secded::blockBitSize(size_t messageBitSize) const
+{
+	return (messageBitSize + kDataSize * 8 - 1) / (kDataSize * 8) * kBlockSize * 8;
+}
+
+uint8_t Secded::check(uint64_t word)
+{
+	uint8_t check = 0;
+	for (size_t i = 0; i < 7; i++)
+		check |= static_cast<uint8_t>(parity(word & kTables.masks[i]) << i);
+	return static_cast<uint8_t>(check | ((parity(word) ^ parity(check)) << 7));
+}
+
+uint8_t Secded::parity(uint64_t word)
+{
+	word ^= word >> 32;
+	word ^= word >> 16;
+	word ^= word >> 8;
+	word ^= word >> 4;
+	word ^= word >> 2;
+	word ^= word >> 1;
+	return static_cast<uint8_t>(word & 1);
+}
+} /* namespace semf */
@@ -0,0 +1,100 @@
+/**
+ * @file secded.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_SECDED_H_
+#define SEMF_UTILS_PROCESSING_SECDED_H_
+
+#include <semf/app/processing/errorcorrectioncode.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief SECDED(72,64) error correction code (single error correction, double error detection).
+ *
+ * Every 64 bit data word is stored as a block of nine bytes: the eight data bytes unchanged, followed by one check
+ * byte with seven Hamming parity bits and an overall parity bit. The parity bits are calculated over whole words
+ * with masks and the bit to correct is taken from a syndrome lookup table, so no loop over single bits is needed.
+ *
+ * Single bit errors in a block are corrected, double bit errors are detected and reported by the \c error signal.
+ *
+ * @note Data sizes are given in bits and buffer sizes in bytes. Data which does not fill a whole word is padded
+ *       with zeros, so \c decode() always returns whole words.
+ */
+class Secded : public app::ErrorCorrectionCode
+{
+public:
+	/**
+	 * @brief Error codes for this class. Error ID identify a unique error() / onError call (excluding transferring).
+	 */
+	enum class ErrorCode : uint8_t
+	{
+		Decode_Uncorrectable = 0
+	};
+
+	/**Number of data bytes of a block.*/
+	static constexpr size_t kDataSize = 8;
+	/**Number of bytes of a block including the check byte.*/
+	static constexpr size_t kBlockSize = 9;
+
+	Secded() = default;
+	explicit Secded(const Secded& other) = delete;
+	virtual ~Secded() = default;
+
+	/**
+	 * @copydoc app::ErrorCorrectionCode::encode()
+	 * @return The number of bits that have been written into the buffer, zero if the buffer is too small.
+	 */
+	size_t encode(const uint8_t data[], size_t dataBitSize, uint8_t buffer[], size_t bufferSize) const override;
+	/**
+	 * @copydoc app::ErrorCorrectionCode::decode()
+	 * @return The number of bits that have been written into the buffer, zero if the buffer is too small.
+	 * @throws Decode_Uncorrectable For every block with more than one bit error, the block is copied uncorrected.
+	 */
+	size_t decode(const uint8_t data[], size_t dataSize, uint8_t buffer[], size_t bufferSize) const override;
+	size_t blockBitSize(size_t messageBitSize) const override;
+
+private:
+	/**Lookup tables.*/
+	struct Tables
+	{
+		/**Masks of the data bits covered by each of the seven parity bits.*/
+		uint64_t masks[7];
+		/**Data bit to correct for a syndrome, \c kNoDataBit for parity bits and unused syndromes.*/
+		uint8_t syndromes[128];
+	};
+	/**Entry of the syndrome table not belonging to a data bit.*/
+	static constexpr uint8_t kNoDataBit = 0xff;
+
+	/**
+	 * @brief Generates the lookup tables.
+	 * @return Lookup tables.
+	 */
+	static constexpr Tables generateTables();
+	/**
+	 * @brief Calculates the check byte of a data word.
+	 * @param word Data word.
+	 * @return Seven parity bits in the lower bits, the overall parity in the highest bit.
+	 */
+	static uint8_t check(uint64_t word);
+	/**
+	 * @brief Calculates the parity of a word.
+	 * @param word Word.
+	 * @return One for an odd number of set bits, zero otherwise.
+	 */
+	static uint8_t parity(uint64_t word);
+
+	/**Lookup tables generated at compile time.*/
+	static const Tables kTables;
+	/**Class ID for error tracing.*/
+	static constexpr Error::ClassID kSemfClassId = Error::ClassID::Secded;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_SECDED_H_ */
@@ -0,0 +1,175 @@
+/**
+ * @file sha256software.cpp
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/utils/core/debug.h>
+#include <semf/utils/processing/sha256software.h>
+#include <algorithm>
+#include <cstring>
+
+namespace semf
+{
+const uint32_t Sha256Software::kRoundConstants[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be,
+	0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa,
+	0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85,
+	0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f,
+	0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+Sha256Software::Sha256Software()
+{
+	start();
+}
+
+void Sha256Software::start()
+{
+	SEMF_INFO("start");
+	m_state[0] = 0x6a09e667;
+	m_state[1] = 0xbb67ae85;
+	m_state[2] = 0x3c6ef372;
+	m_state[3] = 0xa54ff53a;
+	m_state[4] = 0x510e527f;
+	m_state[5] = 0x9b05688c;
+	m_state[6] = 0x1f83d9ab;
+	m_state[7] = 0x5be0cd19;
+	m_blockUsed = 0;
+	m_length = 0;
+}
+
+void Sha256Software::update(uint8_t data[], size_t dataSize)
+{
+	m_length += dataSize;
+
+	if (m_blockUsed > 0)
+	{
+		size_t size = std::min(kBlockSize - m_blockUsed, dataSize);
+		std::memcpy(&m_block[m_blockUsed], data, size);
+		m_blockUsed += size;
+		data += size;
+		dataSize -= size;
+		if (m_blockUsed < kBlockSize)
+			return;
+		compress(m_block, 1);
+		m_blockUsed = 0;
+	}
+
+	size_t blockCount = dataSize / kBlockSize;
+	compress(data, blockCount);
+	data += blockCount * kBlockSize;
+	dataSize -= blockCount * kBlockSize;
+
+	std::memcpy(m_block, data, dataSize);
+	m_blockUsed = dataSize;
+}
+
+void Sha256Software::finish(uint8_t buffer[], size_t bufferSize)
+{
+	uint64_t bitLength = m_length * 8;
+
+	// Padding: a single one bit, zeros up to 56 bytes in the last block and the message length in bits.
+	m_block[m_blockUsed++] = 0x80;
+	if (m_blockUsed > kBlockSize - 8)
+	{
+		std::memset(&m_block[m_blockUsed], 0, kBlockSize - m_blockUsed);
+		compress(m_block, 1);
+		m_blockUsed = 0;
+	}
+	std::memset(&m_block[m_blockUsed], 0, kBlockSize - 8 - m_blockUsed);
+	for (size_t i = 0; i < 8; i++)
+		m_block[kBlockSize - 1 - i] = static_cast<uint8_t>(bitLength >> (i * 8));
+	compress(m_block, 1);
+	m_blockUsed = 0;
+
+	size_t size = std::min(bufferSize, kDigestSize);
+	for (size_t i = 0; i < size; i++)
+		buffer[i] = static_cast<uint8_t>(m_state[i / 4] >> (24 - (i % 4) * 8));
+	SEMF_INFO("finished with hash size %u", size);
+}
+
+void Sha256Software::compress(const uint8_t data[], size_t blockCount)
+{
+// Round with the variables rotated by the caller, so no moves between the rounds are needed.
+#define SEMF_SHA256_ROUND(a, b, c, d, e, f, g, h, i)                                                        \
+	{                                                                                                       \
+		uint32_t t1 = h + (rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25)) + ((e & f) ^ (~e & g)) + \
+					  kRoundConstants[round + i] + w[i];                                                    \
+		uint32_t t2 = (rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22)) + ((a & b) ^ (a & c) ^ (b & c)); \
+		d += t1;                                                                                            \
+		h = t1 + t2;                                                                                        \
+	}
+
+	for (; blockCount > 0; blockCount--, data += kBlockSize)
+	{
+		uint32_t w[16];
+		for (size_t i = 0; i < 16; i++)
+			w[i] = loadBigEndian(&data[i * 4]);
+
+		uint32_t a = m_state[0];
+		uint32_t b = m_state[1];
+		uint32_t c = m_state[2];
+		uint32_t d = m_state[3];
+		uint32_t e = m_state[4];
+		uint32_t f = m_state[5];
+		uint32_t g = m_state[6];
+		uint32_t h = m_state[7];
+
+		for (size_t round = 0; round < 64; round += 16)
+		{
+			if (round > 0)
+			{
+				// Message schedule for the next 16 rounds, calculated in place.
+				for (size_t i = 0; i < 16; i++)
+				{
+					uint32_t w1 = w[(i + 1) & 15];
+					uint32_t w14 = w[(i + 14) & 15];
+					uint32_t s0 = rotateRight(w1, 7) ^ rotateRight(w1, 18) ^ (w1 >> 3);
+					uint32_t s1 = rotateRight(w14, 17) ^ rotateRight(w14, 19) ^ (w14 >> 10);
+					w[i] += s0 + w[(i + 9) & 15] + s1;
+				}
+			}
+			SEMF_SHA256_ROUND(a, b, c, d, e, f, g, h, 0);
+			SEMF_SHA256_ROUND(h, a, b, c, d, e, f, g, 1);
+			SEMF_SHA256_ROUND(g, h, a, b, c, d, e, f, 2);
+			SEMF_SHA256_ROUND(f, g, h, a, b, c, d, e, 3);
+			SEMF_SHA256_ROUND(e, f, g, h, a, b, c, d, 4);
+			SEMF_SHA256_ROUND(d, e, f, g, h, a, b, c, 5);
+			SEMF_SHA256_ROUND(c, d, e, f, g, h, a, b, 6);
+			SEMF_SHA256_ROUND(b, c, d, e, f, g, h, a, 7);
+			SEMF_SHA256_ROUND(a, b, c, d, e, f, g, h, 8);
+			SEMF_SHA256_ROUND(h, a, b, c, d, e, f, g, 9);
+			SEMF_SHA256_ROUND(g, h, a, b, c, d, e, f, 10);
+			SEMF_SHA256_ROUND(f, g, h, a, b, c, d, e, 11);
+			SEMF_SHA256_ROUND(e, f, g, h, a, b, c, d, 12);
+			SEMF_SHA256_ROUND(d, e, f, g, h, a, b, c, 13);
+			SEMF_SHA256_ROUND(c, d, e, f, g, h, a, b, 14);
+			SEMF_SHA256_ROUND(b, c, d, e, f, g, h, a, 15);
+		}
+
+		m_state[0] += a;
+		m_state[1] += b;
+		m_state[2] += c;
+		m_state[3] += d;
+		m_state[4] += e;
+		m_state[5] += f;
+		m_state[6] += g;
+		m_state[7] += h;
+	}
+#undef SEMF_SHA256_ROUND
+}
+uint32_t Sha256Software::rotateRight(uint32_t value, unsigned int count)
+{
+	return (value >> count) | (value << (32 - count));
+}
+
+uint32_t Sha256Software::loadBigEndian(const uint8_t data[])
+{
+	return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) |
+		   static_cast<uint32_t>(data[3]);
+}
+} /* namespace semf */
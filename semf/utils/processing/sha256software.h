@@ -0,0 +1,80 @@
+/**
+ * @file sha256software.h
+ * @date 16.10.2026
+ * @author nk
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_PROCESSING_SHA256SOFTWARE_H_
+#define SEMF_UTILS_PROCESSING_SHA256SOFTWARE_H_
+
+#include <semf/app/processing/hash.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief SHA-256 hash calculation in software (FIPS 180-4).
+ *
+ * Whole 64 byte blocks are compressed directly from the data given to \c update(). Only data not filling a whole
+ * block is copied into an internal block buffer and completed by the next \c update() or \c finish() call.
+ */
+class Sha256Software : public app::Hash
+{
+public:
+	/**Size of the hash result in bytes.*/
+	static constexpr size_t kDigestSize = 32;
+	/**Size of a data block in bytes.*/
+	static constexpr size_t kBlockSize = 64;
+
+	Sha256Software();
+	explicit Sha256Software(const Sha256Software& other) = delete;
+	virtual ~Sha256Software() = default;
+
+	void start() override;
+	void update(uint8_t data[], size_t dataSize) override;
+	/**
+	 * @copydoc app::Hash::finish()
+	 * @note If \c bufferSize is smaller than \c kDigestSize, the hash result is truncated.
+	 * @note \c start() has to be called before calculating the next hash.
+	 */
+	void finish(uint8_t buffer[], size_t bufferSize) override;
+
+private:
+	/**
+	 * @brief Compresses data blocks into the hash state.
+	 * @param data Data blocks in big endian byte order.
+	 * @param blockCount Number of 64 byte blocks.
+	 */
+	void compress(const uint8_t data[], size_t blockCount);
+	/**
+	 * @brief Rotates a value to the right.
+	 * @param value Value to rotate.
+	 * @param count Number of bits to rotate, between 1 and 31.
+	 * @return Rotated value.
+	 */
+	static uint32_t rotateRight(uint32_t value, unsigned int count);
+	/**
+	 * @brief Reads a big endian word.
+	 * @param data Pointer to the first byte of the word.
+	 * @return Word.
+	 */
+	static uint32_t loadBigEndian(const uint8_t data[]);
+
+	/**Round constants.*/
+	static const uint32_t kRoundConstants[64];
+
+	/**Hash state.*/
+	uint32_t m_state[8];
+	/**Buffer for data not filling a whole block.*/
+	uint8_t m_block[kBlockSize];
+	/**Number of bytes in \c m_block.*/
+	size_t m_blockUsed = 0;
+	/**Number of bytes hashed since \c start().*/
+	uint64_t m_length = 0;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_PROCESSING_SHA256SOFTWARE_H_ */
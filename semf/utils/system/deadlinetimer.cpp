@@ -0,0 +1,96 @@
+/**
+ * @file deadlinetimer.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/criticalsection.h>
+#include <semf/utils/core/debug.h>
+#include <semf/utils/system/deadlinetimer.h>
+
+namespace semf
+{
+DeadlineTimer::DeadlineTimer(DeadlineScheduler& scheduler, uint32_t interval, bool start)
+: m_scheduler(scheduler),
+  m_interval(interval),
+  m_remaining(interval)
+{
+	if (start)
+		this->start();
+}
+
+void DeadlineTimer::setInterval(uint32_t interval)
+{
+	CriticalSection::enter();
+	m_interval = interval;
+	if (!m_running)
+		m_remaining = interval;
+	CriticalSection::exit();
+}
+
+uint32_t DeadlineTimer::interval() const
+{
+	return m_interval;
+}
+
+uint32_t DeadlineTimer::remaining() const
+{
+	CriticalSection::enter();
+	uint32_t remaining = m_remaining;
+	if (m_running)
+	{
+		int32_t difference = static_cast<int32_t>(m_expiry - m_scheduler.now());
+		remaining = difference > 0 ? static_cast<uint32_t>(difference) : 0;
+	}
+	CriticalSection::exit();
+	return remaining;
+}
+
+void DeadlineTimer::reset()
+{
+	CriticalSection::enter();
+	if (m_running)
+	{
+		m_scheduler.unschedule(*this);
+		m_scheduler.schedule(*this, m_interval);
+	}
+	else
+	{
+		m_remaining = m_interval;
+	}
+	CriticalSection::exit();
+}
+
+void DeadlineTimer::start()
+{
+	SEMF_INFO("start");
+	CriticalSection::enter();
+	if (!m_running)
+	{
+		m_running = true;
+		m_scheduler.schedule(*this, m_remaining);
+	}
+	CriticalSection::exit();
+}
+
+void DeadlineTimer::stop()
+{
+	SEMF_INFO("stop");
+	CriticalSection::enter();
+	if (m_running)
+	{
+		m_remaining = remaining();
+		m_scheduler.unschedule(*this);
+		m_running = false;
+	}
+	CriticalSection::exit();
+}
+
+bool DeadlineTimer::isRunning() const
+{
+	return m_running;
+}
+} /* namespace semf */
@@ -0,0 +1,90 @@
+/**
+ * @file deadlinetimer.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_SYSTEM_DEADLINETIMER_H_
+#define SEMF_UTILS_SYSTEM_DEADLINETIMER_H_
+
+#include <semf/app/system/timer.h>
+#include <semf/system/deadlinescheduler.h>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Periodic software timer running in a \c DeadlineScheduler.
+ *
+ * Compared to \c SoftwareTimer, a \c DeadlineTimer does not need a periodic tick. The \c DeadlineScheduler sets
+ * the alarm of its hardware timer to the next expiry, so the microcontroller can sleep until a timer is due.
+ * Setting interval to zero will lead to the same behavior as setting the interval to one.
+ *
+ * @note For using \c DeadlineTimer a global \c CriticalSection object is required.
+ */
+class DeadlineTimer : public app::Timer
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param scheduler The scheduler for the timer.
+	 * @param interval The timer interval in ticks of the hardware timer.
+	 * @param start \li true: DeadlineTimer start running. \li false: Time is not running.
+	 */
+	explicit DeadlineTimer(DeadlineScheduler& scheduler, uint32_t interval = 0, bool start = false);
+	explicit DeadlineTimer(const DeadlineTimer& other) = delete;
+	virtual ~DeadlineTimer() = default;
+
+	/**
+	 * @brief Set the timer interval.
+	 * @note A running timer uses the new interval after the next timeout or \c reset().
+	 * @param interval The timer interval.
+	 */
+	void setInterval(uint32_t interval);
+	/**
+	 * @brief Get the timer interval.
+	 * @return The timer interval.
+	 */
+	uint32_t interval() const;
+	/**
+	 * @brief Get the number of ticks until the next timeout.
+	 * @return Remaining ticks.
+	 */
+	uint32_t remaining() const;
+	/**Restart counting.*/
+	void reset() override;
+	/**
+	 * @brief Start time counting.
+	 * @remark Do not reset the time counter.
+	 */
+	void start() override;
+	/**Stop time counting.*/
+	void stop() override;
+	/**
+	 * @brief Check if the timer is running
+	 * @return \li true: timer is running.
+	 * 		   \li false: timer is not running.
+	 */
+	bool isRunning() const;
+
+private:
+	/**Scheduler the timer runs in.*/
+	DeadlineScheduler& m_scheduler;
+	/**Timer interval.*/
+	uint32_t m_interval;
+	/**Ticks until timeout while the timer is stopped.*/
+	uint32_t m_remaining;
+	/**Tick of the next timeout while the timer is running.*/
+	uint32_t m_expiry = 0;
+	/**On true, timer is running.*/
+	bool m_running = false;
+	/**Next timer in the list of the scheduler.*/
+	DeadlineTimer* m_next = nullptr;
+	/**DeadlineScheduler is friend for scheduling.*/
+	friend class DeadlineScheduler;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_SYSTEM_DEADLINETIMER_H_ */
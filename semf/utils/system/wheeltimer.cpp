@@ -0,0 +1,91 @@
+/**
+ * @file wheeltimer.cpp
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#include <semf/system/criticalsection.h>
+#include <semf/utils/core/debug.h>
+#include <semf/utils/system/wheeltimer.h>
+
+namespace semf
+{
+WheelTimer::WheelTimer(TimerWheel& timerWheel, uint32_t interval, bool start)
+: m_timerWheel(timerWheel),
+  m_interval(interval),
+  m_remaining(interval)
+{
+	if (start)
+		this->start();
+}
+
+void WheelTimer::setInterval(uint32_t interval)
+{
+	CriticalSection::enter();
+	m_interval = interval;
+	if (!m_running)
+		m_remaining = interval;
+	CriticalSection::exit();
+}
+
+uint32_t WheelTimer::interval() const
+{
+	return m_interval;
+}
+
+uint32_t WheelTimer::remaining() const
+{
+	CriticalSection::enter();
+	uint32_t remaining = m_running ? m_expiry - m_timerWheel.now() : m_remaining;
+	CriticalSection::exit();
+	return remaining;
+}
+
+void WheelTimer::reset()
+{
+	CriticalSection::enter();
+	if (m_running)
+	{
+		m_timerWheel.unschedule(*this);
+		m_timerWheel.schedule(*this, m_interval);
+	}
+	else
+	{
+		m_remaining = m_interval;
+	}
+	CriticalSection::exit();
+}
+
+void WheelTimer::start()
+{
+	SEMF_INFO("start");
+	CriticalSection::enter();
+	if (!m_running)
+	{
+		m_running = true;
+		m_timerWheel.schedule(*this, m_remaining);
+	}
+	CriticalSection::exit();
+}
+
+void WheelTimer::stop()
+{
+	SEMF_INFO("stop");
+	CriticalSection::enter();
+	if (m_running)
+	{
+		m_remaining = m_expiry - m_timerWheel.now();
+		m_timerWheel.unschedule(*this);
+		m_running = false;
+	}
+	CriticalSection::exit();
+}
+
+bool WheelTimer::isRunning() const
+{
+	return m_running;
+}
+} /* namespace semf */
@@ -0,0 +1,92 @@
+/**
+ * @file wheeltimer.h
+ * @date 16.10.2026
+ * @author fs
+ * @copyright Copyright (C) querdenker engineering GmbH - All Rights Reserved
+ *            For detailed information, read the license file in
+ *            the project root directory.
+ */
+
+#ifndef SEMF_UTILS_SYSTEM_WHEELTIMER_H_
+#define SEMF_UTILS_SYSTEM_WHEELTIMER_H_
+
+#include <semf/app/system/timer.h>
+#include <semf/system/timerwheel.h>
+#include <semf/utils/core/lists/linkedlist.h>
+#include <cstdint>
+
+namespace semf
+{
+/**
+ * @brief Periodic software timer running in a \c TimerWheel.
+ *
+ * Compared to \c SoftwareTimer, a \c WheelTimer does not count every tick itself.
+ * Instead it is sorted into the slot of its expiry tick in the \c TimerWheel and only touched when it is due.
+ * Setting interval to zero will lead to the same behavior as setting the interval to one.
+ *
+ * @note For using \c WheelTimer a global \c CriticalSection object is required.
+ * @note \c LinkedList::Node has to be the first base class, because \c LinkedList casts its end element to \c WheelTimer.
+ */
+class WheelTimer : public LinkedList<WheelTimer>::Node, public app::Timer
+{
+public:
+	/**
+	 * @brief Constructor.
+	 * @param timerWheel The timer wheel for the timer.
+	 * @param interval The timer interval.
+	 * @param start \li true: WheelTimer start running. \li false: Time is not running.
+	 */
+	explicit WheelTimer(TimerWheel& timerWheel, uint32_t interval = 0, bool start = false);
+	explicit WheelTimer(const WheelTimer& other) = delete;
+	virtual ~WheelTimer() = default;
+
+	/**
+	 * @brief Set the timer interval.
+	 * @note A running timer uses the new interval after the next timeout or \c reset().
+	 * @param interval The timer interval.
+	 */
+	void setInterval(uint32_t interval);
+	/**
+	 * @brief Get the timer interval.
+	 * @return The timer interval.
+	 */
+	uint32_t interval() const;
+	/**
+	 * @brief Get the number of ticks until the next timeout.
+	 * @return Remaining ticks.
+	 */
+	uint32_t remaining() const;
+	/**Restart counting.*/
+	void reset() override;
+	/**
+	 * @brief Start time counting.
+	 * @remark Do not reset the time counter.
+	 */
+	void start() override;
+	/**Stop time counting.*/
+	void stop() override;
+	/**
+	 * @brief Check if the timer is running
+	 * @return \li true: timer is running.
+	 * 		   \li false: timer is not running.
+	 */
+	bool isRunning() const;
+
+private:
+	/**Timer wheel the timer runs in.*/
+	TimerWheel& m_timerWheel;
+	/**Timer interval.*/
+	uint32_t m_interval;
+	/**Ticks until timeout while the timer is stopped.*/
+	uint32_t m_remaining;
+	/**Tick of the next timeout while the timer is running.*/
+	uint32_t m_expiry = 0;
+	/**On true, timer is running.*/
+	bool m_running = false;
+	/**List the timer is currently sorted in.*/
+	LinkedList<WheelTimer>* m_list = nullptr;
+	/**TimerWheel is friend for scheduling.*/
+	friend class TimerWheel;
+};
+} /* namespace semf */
+#endif /* SEMF_UTILS_SYSTEM_WHEELTIMER_H_ */